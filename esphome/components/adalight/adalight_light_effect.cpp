@@ -9,10 +9,10 @@ static const char *const TAG = "adalight_light_effect";
 static const uint32_t ADALIGHT_ACK_INTERVAL = 1000;
 static const uint32_t ADALIGHT_RECEIVE_TIMEOUT = 1000;
 
-AdalightLightEffect::AdalightLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+AdalightLightEffect::AdalightLightEffect(const std::string &name) : AddressableStreamLightEffect(name) {}
 
 void AdalightLightEffect::start() {
-  AddressableLightEffect::start();
+  AddressableStreamLightEffect::start();
 
   last_ack_ = 0;
   last_byte_ = 0;
@@ -20,9 +20,9 @@ void AdalightLightEffect::start() {
 }
 
 void AdalightLightEffect::stop() {
-  frame_.resize(0);
+  received_ = 0;
 
-  AddressableLightEffect::stop();
+  AddressableStreamLightEffect::stop();
 }
 
 unsigned int AdalightLightEffect::get_frame_size_(int led_count) const {
@@ -34,17 +34,8 @@ unsigned int AdalightLightEffect::get_frame_size_(int led_count) const {
 }
 
 void AdalightLightEffect::reset_frame_(light::AddressableLight &it) {
-  int buffer_capacity = get_frame_size_(it.size());
-
-  frame_.clear();
-  frame_.reserve(buffer_capacity);
-}
-
-void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(Color::BLACK);
-  }
-  it.schedule_show();
+  received_ = 0;
+  get_buffer_(get_frame_size_(it.size()));
 }
 
 void AdalightLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
@@ -63,8 +54,8 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
     this->last_reset_ = now;
   }
 
-  if (!this->frame_.empty() && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
-    ESP_LOGW(TAG, "Frame: Receive timeout (size=%zu).", this->frame_.size());
+  if (this->received_ != 0 && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
+    ESP_LOGW(TAG, "Frame: Receive timeout (size=%zu).", this->received_);
     reset_frame_(it);
     blank_all_leds_(it);
   }
@@ -73,16 +64,25 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
     ESP_LOGV(TAG, "Frame: Available (size=%d).", this->available());
   }
 
-  while (this->available() != 0) {
-    uint8_t data;
-    if (!this->read_byte(&data))
+  bool consumed = false;
+  int available;
+  while ((available = this->available()) > 0) {
+    // Read the 6 byte header one byte at a time, so an invalid frame is dropped right away, then the LED data in bulk
+    size_t len = 1;
+    if (this->received_ >= 6) {
+      uint16_t led_count = (this->buffer_[3] << 8) + this->buffer_[4] + 1;
+      len = std::min<size_t>(available, get_frame_size_(led_count) - this->received_);
+    }
+
+    uint8_t *buffer = get_buffer_(this->received_ + len);
+    if (!this->read_array(buffer + this->received_, len))
       break;
-    this->frame_.push_back(data);
+    this->received_ += len;
     this->last_byte_ = now;
 
     switch (this->parse_frame_(it)) {
       case INVALID:
-        ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=%d).", this->frame_.size(), this->frame_[0]);
+        ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=%d).", this->received_, this->buffer_[0]);
         reset_frame_(it);
         break;
 
@@ -90,51 +90,49 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
         break;
 
       case CONSUMED:
-        ESP_LOGV(TAG, "Frame: Consumed (size=%zu).", this->frame_.size());
+        ESP_LOGV(TAG, "Frame: Consumed (size=%zu).", this->received_);
+        consumed = true;
         reset_frame_(it);
         break;
     }
   }
+
+  if (consumed)
+    it.schedule_show();
 }
 
 AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableLight &it) {
-  if (frame_.empty())
+  const uint8_t *frame = buffer_.data();
+  size_t size = received_;
+
+  if (size == 0)
     return INVALID;
 
   // Check header: `Ada`
-  if (frame_[0] != 'A')
+  if (frame[0] != 'A')
     return INVALID;
-  if (frame_.size() > 1 && frame_[1] != 'd')
+  if (size > 1 && frame[1] != 'd')
     return INVALID;
-  if (frame_.size() > 2 && frame_[2] != 'a')
+  if (size > 2 && frame[2] != 'a')
     return INVALID;
 
   // 3 bytes: Count Hi, Count Lo, Checksum
-  if (frame_.size() < 6)
+  if (size < 6)
     return PARTIAL;
 
   // Check checksum
-  uint16_t checksum = frame_[3] ^ frame_[4] ^ 0x55;
-  if (checksum != frame_[5])
+  uint16_t checksum = frame[3] ^ frame[4] ^ 0x55;
+  if (checksum != frame[5])
     return INVALID;
 
   // Check if we received the full frame
-  uint16_t led_count = (frame_[3] << 8) + frame_[4] + 1;
+  uint16_t led_count = (frame[3] << 8) + frame[4] + 1;
   auto buffer_size = get_frame_size_(led_count);
-  if (frame_.size() < buffer_size)
+  if (size < buffer_size)
     return PARTIAL;
 
-  // Apply lights
-  auto accepted_led_count = std::min<int>(led_count, it.size());
-  uint8_t *led_data = &frame_[6];
-
-  for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
-    auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
-
-    it[led].set(Color(led_data[0], led_data[1], led_data[2], white));
-  }
-
-  it.schedule_show();
+  // Apply lights, white is derived from the RGB values
+  it.write_rgb(0, &frame[6], led_count, true);
   return CONSUMED;
 }
 
@@ -4,12 +4,10 @@
 #include "esphome/components/light/addressable_light_effect.h"
 #include "esphome/components/uart/uart.h"
 
-#include <vector>
-
 namespace esphome {
 namespace adalight {
 
-class AdalightLightEffect : public light::AddressableLightEffect, public uart::UARTDevice {
+class AdalightLightEffect : public light::AddressableStreamLightEffect, public uart::UARTDevice {
  public:
   AdalightLightEffect(const std::string &name);
 
@@ -26,13 +24,13 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
 
   unsigned int get_frame_size_(int led_count) const;
   void reset_frame_(light::AddressableLight &it);
-  void blank_all_leds_(light::AddressableLight &it);
   Frame parse_frame_(light::AddressableLight &it);
 
   uint32_t last_ack_{0};
   uint32_t last_byte_{0};
   uint32_t last_reset_{0};
-  std::vector<uint8_t> frame_;
+  /// Number of bytes of the current frame in the receive buffer
+  size_t received_{0};
 };
 
 }  // namespace adalight
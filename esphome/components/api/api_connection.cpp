@@ -1,4 +1,5 @@
 #include "api_connection.h"
+#include <algorithm>
 #include <cerrno>
 #include <cinttypes>
 #include "esphome/components/network/util.h"
@@ -19,6 +20,9 @@
 #ifdef USE_VOICE_ASSISTANT
 #include "esphome/components/voice_assistant/voice_assistant.h"
 #endif
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
 
 namespace esphome {
 namespace api {
@@ -60,6 +64,9 @@ APIConnection::~APIConnection() {
 }
 
 void APIConnection::loop() {
+#ifdef USE_TICKLESS_LOOP
+  this->idle_ = false;
+#endif
   if (this->remove_)
     return;
 
@@ -85,7 +92,8 @@ void APIConnection::loop() {
   }
   ReadPacketBuffer buffer;
   err = helper_->read_packet(&buffer);
-  if (err == APIError::WOULD_BLOCK) {
+  bool read_would_block = err == APIError::WOULD_BLOCK;
+  if (read_would_block) {
     // pass
   } else if (err != APIError::OK) {
     on_fatal_error();
@@ -158,6 +166,21 @@ void APIConnection::loop() {
       }
     }
   }
+
+  if (this->state_batch_size_ != 0 && now - this->state_batch_start_ >= this->parent_->get_batch_delay()) {
+    if (!this->flush_state_batch_())
+      return;
+  }
+
+#ifdef USE_TICKLESS_LOOP
+  // Nothing left to do until the client sends something, the tx backlog can drain or a state update comes in
+  this->idle_ = read_would_block && this->helper_->can_write_without_blocking() &&
+                this->list_entities_iterator_.completed() && this->initial_state_iterator_.completed() &&
+                this->state_subs_at_ == -1 && this->state_batch_size_ == 0;
+#ifdef USE_ESP32_CAMERA
+  this->idle_ = this->idle_ && !this->image_reader_.available();
+#endif
+#endif
 }
 
 std::string get_default_unique_id(const std::string &component_type, EntityBase *entity) {
@@ -186,7 +209,7 @@ bool APIConnection::send_binary_sensor_state(binary_sensor::BinarySensor *binary
   resp.key = binary_sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !binary_sensor->has_state();
-  return this->send_binary_sensor_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_binary_sensor_state_response(resp); });
 }
 bool APIConnection::send_binary_sensor_info(binary_sensor::BinarySensor *binary_sensor) {
   ListEntitiesBinarySensorResponse msg;
@@ -218,7 +241,7 @@ bool APIConnection::send_cover_state(cover::Cover *cover) {
   if (traits.get_supports_tilt())
     resp.tilt = cover->tilt;
   resp.current_operation = static_cast<enums::CoverOperation>(cover->current_operation);
-  return this->send_cover_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_cover_state_response(resp); });
 }
 bool APIConnection::send_cover_info(cover::Cover *cover) {
   auto traits = cover->get_traits();
@@ -283,7 +306,7 @@ bool APIConnection::send_fan_state(fan::Fan *fan) {
   }
   if (traits.supports_direction())
     resp.direction = static_cast<enums::FanDirection>(fan->direction);
-  return this->send_fan_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_fan_state_response(resp); });
 }
 bool APIConnection::send_fan_info(fan::Fan *fan) {
   auto traits = fan->get_traits();
@@ -346,7 +369,7 @@ bool APIConnection::send_light_state(light::LightState *light) {
   resp.warm_white = values.get_warm_white();
   if (light->supports_effects())
     resp.effect = light->get_effect_name();
-  return this->send_light_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_light_state_response(resp); });
 }
 bool APIConnection::send_light_info(light::LightState *light) {
   auto traits = light->get_traits();
@@ -429,7 +452,7 @@ bool APIConnection::send_sensor_state(sensor::Sensor *sensor, float state) {
   resp.key = sensor->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !sensor->has_state();
-  return this->send_sensor_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_sensor_state_response(resp); });
 }
 bool APIConnection::send_sensor_info(sensor::Sensor *sensor) {
   ListEntitiesSensorResponse msg;
@@ -460,7 +483,7 @@ bool APIConnection::send_switch_state(switch_::Switch *a_switch, bool state) {
   SwitchStateResponse resp{};
   resp.key = a_switch->get_object_id_hash();
   resp.state = state;
-  return this->send_switch_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_switch_state_response(resp); });
 }
 bool APIConnection::send_switch_info(switch_::Switch *a_switch) {
   ListEntitiesSwitchResponse msg;
@@ -498,7 +521,7 @@ bool APIConnection::send_text_sensor_state(text_sensor::TextSensor *text_sensor,
   resp.key = text_sensor->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !text_sensor->has_state();
-  return this->send_text_sensor_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_text_sensor_state_response(resp); });
 }
 bool APIConnection::send_text_sensor_info(text_sensor::TextSensor *text_sensor) {
   ListEntitiesTextSensorResponse msg;
@@ -544,7 +567,7 @@ bool APIConnection::send_climate_state(climate::Climate *climate) {
     resp.custom_preset = climate->custom_preset.value();
   if (traits.get_supports_swing_modes())
     resp.swing_mode = static_cast<enums::ClimateSwingMode>(climate->swing_mode);
-  return this->send_climate_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_climate_state_response(resp); });
 }
 bool APIConnection::send_climate_info(climate::Climate *climate) {
   auto traits = climate->get_traits();
@@ -622,7 +645,7 @@ bool APIConnection::send_number_state(number::Number *number, float state) {
   resp.key = number->get_object_id_hash();
   resp.state = state;
   resp.missing_state = !number->has_state();
-  return this->send_number_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_number_state_response(resp); });
 }
 bool APIConnection::send_number_info(number::Number *number) {
   ListEntitiesNumberResponse msg;
@@ -664,7 +687,7 @@ bool APIConnection::send_select_state(select::Select *select, std::string state)
   resp.key = select->get_object_id_hash();
   resp.state = std::move(state);
   resp.missing_state = !select->has_state();
-  return this->send_select_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_select_state_response(resp); });
 }
 bool APIConnection::send_select_info(select::Select *select) {
   ListEntitiesSelectResponse msg;
@@ -724,7 +747,7 @@ bool APIConnection::send_lock_state(lock::Lock *a_lock, lock::LockState state) {
   LockStateResponse resp{};
   resp.key = a_lock->get_object_id_hash();
   resp.state = static_cast<enums::LockState>(state);
-  return this->send_lock_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_lock_state_response(resp); });
 }
 bool APIConnection::send_lock_info(lock::Lock *a_lock) {
   ListEntitiesLockResponse msg;
@@ -770,7 +793,7 @@ bool APIConnection::send_media_player_state(media_player::MediaPlayer *media_pla
   resp.state = static_cast<enums::MediaPlayerState>(media_player->state);
   resp.volume = media_player->volume;
   resp.muted = media_player->is_muted();
-  return this->send_media_player_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_media_player_state_response(resp); });
 }
 bool APIConnection::send_media_player_info(media_player::MediaPlayer *media_player) {
   ListEntitiesMediaPlayerResponse msg;
@@ -940,7 +963,7 @@ bool APIConnection::send_alarm_control_panel_state(alarm_control_panel::AlarmCon
   AlarmControlPanelStateResponse resp{};
   resp.key = a_alarm_control_panel->get_object_id_hash();
   resp.state = static_cast<enums::AlarmControlPanelState>(a_alarm_control_panel->get_state());
-  return this->send_alarm_control_panel_state_response(resp);
+  return this->send_state_(resp.key, [this, &resp]() { return this->send_alarm_control_panel_state_response(resp); });
 }
 bool APIConnection::send_alarm_control_panel_info(alarm_control_panel::AlarmControlPanel *a_alarm_control_panel) {
   ListEntitiesAlarmControlPanelResponse msg;
@@ -990,6 +1013,30 @@ void APIConnection::alarm_control_panel_command(const AlarmControlPanelCommandRe
 }
 #endif
 
+#ifdef USE_PROFILER
+ProfilerStatsResponse APIConnection::get_profiler_stats(const ProfilerStatsRequest &msg) {
+  ProfilerStatsResponse resp;
+  if (profiler::global_profiler == nullptr)
+    return resp;
+  resp.elapsed_ms = profiler::global_profiler->get_elapsed();
+  for (const auto &stats : profiler::global_profiler->get_stats()) {
+    ProfilerStats entry;
+    entry.component = profiler::ProfilerComponent::get_component_name(stats.component);
+    entry.component_index = stats.component_index;
+    entry.scheduler = stats.scheduler;
+    entry.name_hash = stats.name_hash;
+    entry.count = stats.count;
+    entry.total_us = stats.total_us;
+    entry.max_us = stats.max_us;
+    entry.histogram.assign(stats.histogram, stats.histogram + profiler::PROFILER_HISTOGRAM_BUCKETS);
+    resp.stats.push_back(std::move(entry));
+  }
+  if (msg.reset)
+    profiler::global_profiler->reset();
+  return resp;
+}
+#endif
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
@@ -1102,6 +1149,17 @@ void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistant
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
+  if (this->batching_state_) {
+    APIServer::SharedStateResponse *shared = this->parent_->get_shared_state();
+    if (shared != nullptr && !shared->encoded) {
+      // the other clients reuse this encoding of the state
+      shared->payload = *buffer.get_buffer();
+      shared->message_type = message_type;
+      shared->encoded = true;
+    }
+    if (this->parent_->get_batch_delay() != 0)
+      return this->queue_state_(buffer, message_type);
+  }
   if (!this->helper_->can_write_without_blocking()) {
     delay(0);
     APIError err = helper_->loop();
@@ -1132,9 +1190,77 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
     return false;
   }
+#ifdef USE_TICKLESS_LOOP
+  if (!this->helper_->can_write_without_blocking()) {
+    // data is still queued in the frame helper, make sure the server loop flushes it
+    this->parent_->wake();
+  }
+#endif
   // Do not set last_traffic_ on send
   return true;
 }
+bool APIConnection::queue_state_(ProtoWriteBuffer buffer, uint32_t message_type) {
+  size_t index = 0;
+  while (index < this->state_batch_size_ &&
+         (this->state_batch_[index].key != this->batch_key_ || this->state_batch_[index].message_type != message_type))
+    index++;
+  if (index == this->state_batch_size_) {
+    if (this->state_batch_size_ == 0)
+      this->state_batch_start_ = millis();
+    if (index == this->state_batch_.size())
+      this->state_batch_.emplace_back();
+    this->state_batch_[index].message_type = message_type;
+    this->state_batch_[index].key = this->batch_key_;
+    this->state_batch_size_++;
+  }
+  // only the latest state of each entity is sent
+  const auto *payload = buffer.get_buffer();
+  this->state_batch_[index].payload.assign(payload->begin(), payload->end());
+#ifdef USE_TICKLESS_LOOP
+  this->parent_->wake();
+#endif
+  return true;
+}
+bool APIConnection::flush_state_batch_() {
+  // Limit the size of a single write, so that large batches (like the initial states) don't need one big allocation
+  static const size_t MAX_BATCH_WRITE_SIZE = 1436;
+
+  size_t done = 0;
+  std::vector<PacketInfo> packets;
+  while (done < this->state_batch_size_ && this->helper_->can_write_without_blocking()) {
+    this->batch_write_buffer_.clear();
+    packets.clear();
+    size_t end = done;
+    while (end < this->state_batch_size_) {
+      const auto &payload = this->state_batch_[end].payload;
+      if (!packets.empty() && this->batch_write_buffer_.size() + payload.size() > MAX_BATCH_WRITE_SIZE)
+        break;
+      packets.push_back(PacketInfo{static_cast<uint16_t>(this->state_batch_[end].message_type),
+                                   static_cast<uint32_t>(this->batch_write_buffer_.size()),
+                                   static_cast<uint32_t>(payload.size())});
+      this->batch_write_buffer_.insert(this->batch_write_buffer_.end(), payload.begin(), payload.end());
+      end++;
+    }
+
+    APIError err = this->helper_->write_packets(this->batch_write_buffer_.data(), packets.data(), packets.size());
+    if (err == APIError::WOULD_BLOCK)
+      break;
+    if (err != APIError::OK) {
+      on_fatal_error();
+      ESP_LOGW(TAG, "%s: Packet write failed %s errno=%d", client_info_.c_str(), api_error_to_str(err), errno);
+      return false;
+    }
+    done = end;
+  }
+
+  if (done != 0) {
+    // the socket may be full, the remaining states move to the front and keep coalescing until it drains
+    std::rotate(this->state_batch_.begin(), this->state_batch_.begin() + done,
+                this->state_batch_.begin() + this->state_batch_size_);
+    this->state_batch_size_ -= done;
+  }
+  return true;
+}
 void APIConnection::on_unauthenticated_access() {
   this->on_fatal_error();
   ESP_LOGD(TAG, "%s: tried to access without authentication.", this->client_info_.c_str());
@@ -135,6 +135,10 @@ class APIConnection : public APIServerConnection {
   void alarm_control_panel_command(const AlarmControlPanelCommandRequest &msg) override;
 #endif
 
+#ifdef USE_PROFILER
+  ProfilerStatsResponse get_profiler_stats(const ProfilerStatsRequest &msg) override;
+#endif
+
   void on_disconnect_response(const DisconnectResponse &value) override;
   void on_ping_response(const PingResponse &value) override {
     // we initiated ping
@@ -188,6 +192,29 @@ class APIConnection : public APIServerConnection {
 
   bool send_(const void *buf, size_t len, bool force);
 
+  /** Send a state response of the entity with \p key through the state batch.
+   *
+   * \p send is called to encode the response, unless another client already encoded it while the server broadcasts
+   * the same publish (see APIServer::get_shared_state()). If batching is enabled, send_buffer() queues the encoded
+   * message in state_batch_ instead of writing it, replacing an earlier queued state of the same entity.
+   */
+  template<typename F> bool send_state_(uint32_t key, F send) {
+    this->batch_key_ = key;
+    this->batching_state_ = true;
+    bool ret;
+    APIServer::SharedStateResponse *shared = this->parent_->get_shared_state();
+    if (shared != nullptr && shared->encoded) {
+      ret = this->send_buffer(ProtoWriteBuffer{&shared->payload}, shared->message_type);
+    } else {
+      ret = send();
+    }
+    this->batching_state_ = false;
+    return ret;
+  }
+  bool queue_state_(ProtoWriteBuffer buffer, uint32_t message_type);
+  /// Write as much of the state batch as the socket takes, returns false on a fatal error.
+  bool flush_state_batch_();
+
   enum class ConnectionState {
     WAITING_FOR_HELLO,
     CONNECTED,
@@ -195,10 +222,33 @@ class APIConnection : public APIServerConnection {
   } connection_state_{ConnectionState::WAITING_FOR_HELLO};
 
   bool remove_{false};
+#ifdef USE_TICKLESS_LOOP
+  /// Whether the last loop() call found no pending work, see APIServer::loop().
+  bool idle_{false};
+#endif
 
   // Buffer used to encode proto messages
   // Re-use to prevent allocations
   std::vector<uint8_t> proto_write_buffer_;
+
+  struct BatchedState {
+    uint32_t message_type;
+    uint32_t key;
+    std::vector<uint8_t> payload;
+  };
+  /** State responses waiting to be sent, in the order their entities were first updated.
+   *
+   * Only the first state_batch_size_ entries are queued, the ones after that are kept around so that their payload
+   * buffers are reused by the next batch. A batch holds at most one state per entity, a linear search is cheaper
+   * than maintaining an index for these sizes.
+   */
+  std::vector<BatchedState> state_batch_;
+  size_t state_batch_size_{0};
+  /// The concatenated payloads of a batch that is being written.
+  std::vector<uint8_t> batch_write_buffer_;
+  uint32_t state_batch_start_{0};
+  uint32_t batch_key_{0};
+  bool batching_state_{false};
   std::unique_ptr<APIFrameHelper> helper_;
 
   std::string client_info_;
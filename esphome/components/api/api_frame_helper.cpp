@@ -467,7 +467,7 @@ APIError APINoiseFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APINoiseFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APINoiseFrameHelper::write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) {
   int err;
   APIError aerr;
   aerr = state_action_();
@@ -479,42 +479,56 @@ APIError APINoiseFrameHelper::write_packet(uint16_t type, const uint8_t *payload
     return APIError::WOULD_BLOCK;
   }
 
-  size_t padding = 0;
-  size_t msg_len = 4 + payload_len + padding;
-  size_t frame_len = 3 + msg_len + noise_cipherstate_get_mac_length(send_cipher_);
-  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[frame_len]};
+  // every packet is its own noise frame, but all frames go out with a single write
+  const size_t mac_len = noise_cipherstate_get_mac_length(send_cipher_);
+  size_t buf_len = 0;
+  for (size_t i = 0; i < count; i++)
+    buf_len += 3 + 4 + packets[i].length + mac_len;
+  auto tmpbuf = std::unique_ptr<uint8_t[]>{new (std::nothrow) uint8_t[buf_len]};
   if (tmpbuf == nullptr) {
     HELPER_LOG("Could not allocate for writing packet");
     return APIError::OUT_OF_MEMORY;
   }
 
-  tmpbuf[0] = 0x01;  // indicator
-  // tmpbuf[1], tmpbuf[2] to be set later
-  const uint8_t msg_offset = 3;
-  const uint8_t payload_offset = msg_offset + 4;
-  tmpbuf[msg_offset + 0] = (uint8_t) (type >> 8);  // type
-  tmpbuf[msg_offset + 1] = (uint8_t) type;
-  tmpbuf[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
-  tmpbuf[msg_offset + 3] = (uint8_t) payload_len;
-  // copy data
-  std::copy(payload, payload + payload_len, &tmpbuf[payload_offset]);
-  // fill padding with zeros
-  std::fill(&tmpbuf[payload_offset + payload_len], &tmpbuf[frame_len], 0);
+  size_t total_len = 0;
+  for (size_t i = 0; i < count; i++) {
+    const uint16_t type = packets[i].type;
+    const size_t payload_len = packets[i].length;
+    const uint8_t *payload = data + packets[i].offset;
+
+    size_t padding = 0;
+    size_t msg_len = 4 + payload_len + padding;
+    size_t frame_len = 3 + msg_len + mac_len;
+    uint8_t *frame = &tmpbuf[total_len];
+
+    frame[0] = 0x01;  // indicator
+    // frame[1], frame[2] to be set later
+    const uint8_t msg_offset = 3;
+    const uint8_t payload_offset = msg_offset + 4;
+    frame[msg_offset + 0] = (uint8_t) (type >> 8);  // type
+    frame[msg_offset + 1] = (uint8_t) type;
+    frame[msg_offset + 2] = (uint8_t) (payload_len >> 8);  // data_len
+    frame[msg_offset + 3] = (uint8_t) payload_len;
+    // copy data
+    std::copy(payload, payload + payload_len, &frame[payload_offset]);
+    // fill padding with zeros
+    std::fill(&frame[payload_offset + payload_len], &frame[frame_len], 0);
+
+    NoiseBuffer mbuf;
+    noise_buffer_init(mbuf);
+    noise_buffer_set_inout(mbuf, &frame[msg_offset], msg_len, frame_len - msg_offset);
+    err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
+    if (err != 0) {
+      state_ = State::FAILED;
+      HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
+      return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    }
 
-  NoiseBuffer mbuf;
-  noise_buffer_init(mbuf);
-  noise_buffer_set_inout(mbuf, &tmpbuf[msg_offset], msg_len, frame_len - msg_offset);
-  err = noise_cipherstate_encrypt(send_cipher_, &mbuf);
-  if (err != 0) {
-    state_ = State::FAILED;
-    HELPER_LOG("noise_cipherstate_encrypt failed: %s", noise_err_to_str(err).c_str());
-    return APIError::CIPHERSTATE_ENCRYPT_FAILED;
+    frame[1] = (uint8_t) (mbuf.size >> 8);
+    frame[2] = (uint8_t) mbuf.size;
+    total_len += 3 + mbuf.size;
   }
 
-  size_t total_len = 3 + mbuf.size;
-  tmpbuf[1] = (uint8_t) (mbuf.size >> 8);
-  tmpbuf[2] = (uint8_t) mbuf.size;
-
   struct iovec iov;
   iov.iov_base = &tmpbuf[0];
   iov.iov_len = total_len;
@@ -903,26 +917,38 @@ APIError APIPlaintextFrameHelper::read_packet(ReadPacketBuffer *buffer) {
   return APIError::OK;
 }
 bool APIPlaintextFrameHelper::can_write_without_blocking() { return state_ == State::DATA && tx_buf_.empty(); }
-APIError APIPlaintextFrameHelper::write_packet(uint16_t type, const uint8_t *payload, size_t payload_len) {
+APIError APIPlaintextFrameHelper::write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) {
   if (state_ != State::DATA) {
     return APIError::BAD_STATE;
   }
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(payload_len).encode(header);
-  ProtoVarInt(type).encode(header);
-
-  struct iovec iov[2];
-  iov[0].iov_base = &header[0];
-  iov[0].iov_len = header.size();
-  if (payload_len == 0) {
-    return write_raw_(iov, 1);
+  // The packets go out with a single writev(). Headers and small payloads are copied into a reused buffer, larger
+  // payloads get their own iovec instead of being copied. tx_header_buf_ is reserved up front (a header has at most
+  // 1 + 5 + 5 bytes), so it isn't reallocated while the iovecs point into it.
+  static const size_t MAX_COPIED_PAYLOAD = 64;
+  size_t scratch_len = 0;
+  for (size_t i = 0; i < count; i++)
+    scratch_len += 11 + (packets[i].length <= MAX_COPIED_PAYLOAD ? packets[i].length : 0);
+  this->tx_header_buf_.clear();
+  this->tx_header_buf_.reserve(scratch_len);
+  this->tx_iov_.clear();
+  size_t start = 0;
+  for (size_t i = 0; i < count; i++) {
+    const uint8_t *payload = data + packets[i].offset;
+    this->tx_header_buf_.push_back(0x00);
+    ProtoVarInt(packets[i].length).encode(this->tx_header_buf_);
+    ProtoVarInt(packets[i].type).encode(this->tx_header_buf_);
+    if (packets[i].length <= MAX_COPIED_PAYLOAD) {
+      this->tx_header_buf_.insert(this->tx_header_buf_.end(), payload, payload + packets[i].length);
+      continue;
+    }
+    this->tx_iov_.push_back({this->tx_header_buf_.data() + start, this->tx_header_buf_.size() - start});
+    this->tx_iov_.push_back({const_cast<uint8_t *>(payload), packets[i].length});
+    start = this->tx_header_buf_.size();
   }
-  iov[1].iov_base = const_cast<uint8_t *>(payload);
-  iov[1].iov_len = payload_len;
-
-  return write_raw_(iov, 2);
+  if (start != this->tx_header_buf_.size())
+    this->tx_iov_.push_back({this->tx_header_buf_.data() + start, this->tx_header_buf_.size() - start});
+  return this->write_raw_(this->tx_iov_.data(), this->tx_iov_.size());
 }
 APIError APIPlaintextFrameHelper::try_send_tx_buf_() {
   // try send from tx_buf
@@ -58,6 +58,13 @@ enum class APIError : int {
 
 const char *api_error_to_str(APIError err);
 
+/// Location of a single packet payload in a buffer passed to APIFrameHelper::write_packets().
+struct PacketInfo {
+  uint16_t type;
+  uint32_t offset;
+  uint32_t length;
+};
+
 class APIFrameHelper {
  public:
   virtual ~APIFrameHelper() = default;
@@ -65,7 +72,12 @@ class APIFrameHelper {
   virtual APIError loop() = 0;
   virtual APIError read_packet(ReadPacketBuffer *buffer) = 0;
   virtual bool can_write_without_blocking() = 0;
-  virtual APIError write_packet(uint16_t type, const uint8_t *data, size_t len) = 0;
+  APIError write_packet(uint16_t type, const uint8_t *data, size_t len) {
+    PacketInfo packet{type, 0, static_cast<uint32_t>(len)};
+    return this->write_packets(data, &packet, 1);
+  }
+  /// Write \p count packets whose payloads are stored in \p data with a single socket write.
+  virtual APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) = 0;
   virtual std::string getpeername() = 0;
   virtual int getpeername(struct sockaddr *addr, socklen_t *addrlen) = 0;
   virtual APIError close() = 0;
@@ -84,7 +96,7 @@ class APINoiseFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -147,7 +159,7 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   APIError loop() override;
   APIError read_packet(ReadPacketBuffer *buffer) override;
   bool can_write_without_blocking() override;
-  APIError write_packet(uint16_t type, const uint8_t *payload, size_t len) override;
+  APIError write_packets(const uint8_t *data, const PacketInfo *packets, size_t count) override;
   std::string getpeername() override { return this->socket_->getpeername(); }
   int getpeername(struct sockaddr *addr, socklen_t *addrlen) override {
     return this->socket_->getpeername(addr, addrlen);
@@ -178,6 +190,9 @@ class APIPlaintextFrameHelper : public APIFrameHelper {
   size_t rx_buf_len_ = 0;
 
   std::vector<uint8_t> tx_buf_;
+  /// Scratch space of write_packets(), kept to avoid allocations: headers and small payloads, and the iovecs.
+  std::vector<uint8_t> tx_header_buf_;
+  std::vector<struct iovec> tx_iov_;
 
   enum class State {
     INITIALIZE = 1,
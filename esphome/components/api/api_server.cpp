@@ -8,6 +8,7 @@
 #include "esphome/core/hal.h"
 #include "esphome/components/network/util.h"
 #include <cerrno>
+#include <cinttypes>
 
 #ifdef USE_LOGGER
 #include "esphome/components/logger/logger.h"
@@ -65,6 +66,12 @@ void APIServer::setup() {
     this->mark_failed();
     return;
   }
+  socket_->set_wake_component(this);
+
+#ifdef USE_TICKLESS_LOOP
+  // keepalive pings and the reboot timeout are time based, check them regularly while idle
+  this->set_interval("tickless_wake", 1000, [this]() { this->wake(); });
+#endif
 
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
@@ -87,6 +94,7 @@ void APIServer::setup() {
             if (!c->remove_)
               c->send_camera_state(image);
           }
+          this->wake();
         });
   }
 #endif
@@ -100,6 +108,7 @@ void APIServer::loop() {
     if (!sock)
       break;
     ESP_LOGD(TAG, "Accepted %s", sock->getpeername().c_str());
+    sock->set_wake_component(this);
 
     auto *conn = new APIConnection(std::move(sock), this);
     clients_.emplace_back(conn);
@@ -133,10 +142,23 @@ void APIServer::loop() {
       this->status_clear_warning();
     }
   }
+
+#ifdef USE_TICKLESS_LOOP
+  bool idle = true;
+  for (auto &client : this->clients_) {
+    if (!client->idle_) {
+      idle = false;
+      break;
+    }
+  }
+  if (idle)
+    this->idle();
+#endif
 }
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network::get_use_address().c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  State batch delay: %" PRIu32 " ms", this->batch_delay_);
 #ifdef USE_API_NOISE
   ESP_LOGCONFIG(TAG, "  Using noise encryption: YES");
 #else
@@ -177,8 +199,10 @@ void APIServer::handle_disconnect(APIConnection *conn) {}
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_binary_sensor_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -186,8 +210,10 @@ void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool s
 void APIServer::on_cover_update(cover::Cover *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_cover_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -195,8 +221,10 @@ void APIServer::on_cover_update(cover::Cover *obj) {
 void APIServer::on_fan_update(fan::Fan *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_fan_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -204,8 +232,10 @@ void APIServer::on_fan_update(fan::Fan *obj) {
 void APIServer::on_light_update(light::LightState *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_light_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -213,8 +243,10 @@ void APIServer::on_light_update(light::LightState *obj) {
 void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_sensor_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -222,8 +254,10 @@ void APIServer::on_sensor_update(sensor::Sensor *obj, float state) {
 void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_switch_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -231,8 +265,10 @@ void APIServer::on_switch_update(switch_::Switch *obj, bool state) {
 void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_text_sensor_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -240,8 +276,10 @@ void APIServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::s
 void APIServer::on_climate_update(climate::Climate *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_climate_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -249,8 +287,10 @@ void APIServer::on_climate_update(climate::Climate *obj) {
 void APIServer::on_number_update(number::Number *obj, float state) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_number_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -258,8 +298,10 @@ void APIServer::on_number_update(number::Number *obj, float state) {
 void APIServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_select_state(obj, state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -267,8 +309,10 @@ void APIServer::on_select_update(select::Select *obj, const std::string &state,
 void APIServer::on_lock_update(lock::Lock *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_lock_state(obj, obj->state);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -276,11 +320,20 @@ void APIServer::on_lock_update(lock::Lock *obj) {
 void APIServer::on_media_player_update(media_player::MediaPlayer *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_media_player_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
+void APIServer::begin_state_broadcast_() {
+  // encoding once only pays off with several clients
+  this->shared_state_active_ = this->clients_.size() > 1;
+  this->shared_state_.encoded = false;
+}
+void APIServer::end_state_broadcast_() { this->shared_state_active_ = false; }
+
 float APIServer::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
 void APIServer::set_port(uint16_t port) { this->port_ = port; }
 APIServer *global_api_server = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
@@ -342,8 +395,10 @@ void APIServer::stop_voice_assistant() {
 void APIServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
   if (obj->is_internal())
     return;
+  this->begin_state_broadcast_();
   for (auto &c : this->clients_)
     c->send_alarm_control_panel_state(obj);
+  this->end_state_broadcast_();
 }
 #endif
 
@@ -31,6 +31,9 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /// Coalesce state updates of each client for \p batch_delay milliseconds, 0 sends every update right away.
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint32_t get_batch_delay() const { return this->batch_delay_; }
 
 #ifdef USE_API_NOISE
   void set_noise_psk(psk_t psk) { noise_ctx_->set_psk(psk); }
@@ -102,15 +105,30 @@ class APIServer : public Component, public Controller {
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
+  /// A state response that is encoded once per publish and sent to all clients.
+  struct SharedStateResponse {
+    bool encoded;
+    uint32_t message_type;
+    std::vector<uint8_t> payload;
+  };
+  /// The state response of the publish that is being sent to the clients, nullptr outside of a broadcast.
+  SharedStateResponse *get_shared_state() { return this->shared_state_active_ ? &this->shared_state_ : nullptr; }
+
  protected:
+  void begin_state_broadcast_();
+  void end_state_broadcast_();
+
   std::unique_ptr<socket::Socket> socket_ = nullptr;
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
+  uint32_t batch_delay_{0};
   uint32_t last_connected_{0};
   std::vector<std::unique_ptr<APIConnection>> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
   std::vector<UserServiceDescriptor *> user_services_;
+  SharedStateResponse shared_state_{};
+  bool shared_state_active_{false};
 
 #ifdef USE_API_NOISE
   std::shared_ptr<APINoiseContext> noise_ctx_ = std::make_shared<APINoiseContext>();
@@ -73,6 +73,9 @@ async def to_code(config):
     if ibeacon_uuid := config.get(CONF_IBEACON_UUID):
         ibeacon_uuid = esp32_ble_tracker.as_hex_array(str(ibeacon_uuid))
         cg.add(var.set_ibeacon_uuid(ibeacon_uuid))
+        await esp32_ble_tracker.register_manufacturer_filter(
+            var, config, esp32_ble_tracker.IBEACON_COMPANY_ID
+        )
 
         if (ibeacon_major := config.get(CONF_IBEACON_MAJOR)) is not None:
             cg.add(var.set_ibeacon_major(ibeacon_major))
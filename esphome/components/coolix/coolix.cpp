@@ -110,7 +110,7 @@ void CoolixClimate::transmit_state() {
 }
 
 bool CoolixClimate::on_coolix(climate::Climate *parent, remote_base::RemoteReceiveData data) {
-  auto decoded = remote_base::CoolixProtocol().decode(data);
+  auto decoded = remote_base::decode_cached<remote_base::CoolixProtocol>(data);
   if (!decoded.has_value())
     return false;
   // Decoded remote state y 3 bytes long code.
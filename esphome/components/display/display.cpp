@@ -1,7 +1,9 @@
 #include "display.h"
+#include "display_color_utils.h"
 
 #include <utility>
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -35,11 +37,34 @@ void HOT Display::line(int x1, int y1, int x2, int y2, Color color) {
     }
   }
 }
-void HOT Display::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
+void HOT Display::horizontal_line(int x, int y, int width, Color color) { this->fill_span(x, y, width, color); }
+void HOT Display::fill_span(int x, int y, int width, Color color) {
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
+void HOT Display::blit_mono_row(int x, int y, const uint8_t *data, int width, Color color_on, Color color_off,
+                                bool transparent) {
+  int start = 0;
+  while (start < width) {
+    const bool on = progmem_read_byte(data + start / 8) & (0x80 >> (start % 8));
+    int end = start + 1;
+    while (end < width && bool(progmem_read_byte(data + end / 8) & (0x80 >> (end % 8))) == on)
+      end++;
+    if (on || !transparent)
+      this->fill_span(x + start, y, end - start, on ? color_on : color_off);
+    start = end;
+  }
+}
+void HOT Display::blit_rgb565_rows(int x, int y, const uint8_t *data, int width, int height, bool transparent) {
+  for (int row = 0; row < height; row++) {
+    for (int col = 0; col < width; col++, data += 2) {
+      const uint16_t rgb565 = progmem_read_byte(data) << 8 | progmem_read_byte(data + 1);
+      if (transparent && rgb565 == 0x0020)
+        continue;
+      this->draw_pixel_at(x + col, y + row, ColorUtil::rgb565_to_color(rgb565));
+    }
+  }
+}
 void HOT Display::vertical_line(int x, int y, int height, Color color) {
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
@@ -181,6 +181,27 @@ class Display {
   /// Set a single pixel at the specified coordinates to the given color.
   virtual void draw_pixel_at(int x, int y, Color color) = 0;
 
+  /** Fill \p width pixels to the right of the point [x,y] with the given color.
+   *
+   * The default implementation calls draw_pixel_at() for every pixel, buffered displays override this to clip and
+   * rotate once per span.
+   */
+  virtual void fill_span(int x, int y, int width, Color color);
+
+  /** Draw one row of a bitmap with one bit per pixel (most significant bit first, stored in PROGMEM) at [x,y].
+   *
+   * Set bits are drawn in color_on, clear bits in color_off unless transparent is set. Runs of equal bits are drawn
+   * with fill_span().
+   */
+  virtual void blit_mono_row(int x, int y, const uint8_t *data, int width, Color color_on, Color color_off,
+                             bool transparent);
+
+  /** Draw \p height rows of \p width big endian RGB565 pixels (stored in PROGMEM) with the top left corner at [x,y].
+   *
+   * If transparent is set, pixels with the value 0x0020 are skipped like in image::Image.
+   */
+  virtual void blit_rgb565_rows(int x, int y, const uint8_t *data, int width, int height, bool transparent);
+
   /// Draw a straight line from the point [x1,y1] to [x2,y2] with the given color.
   void line(int x1, int y1, int x2, int y2, Color color = COLOR_ON);
 
@@ -1,8 +1,10 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
 namespace esphome {
@@ -10,6 +12,19 @@ namespace display {
 
 static const char *const TAG = "display";
 
+/// A changed pixel at most this many pixels away from a dirty rectangle grows that rectangle.
+static const int16_t DIRTY_MERGE_DISTANCE = 8;
+/// Cost of starting another window on the display (address commands, chip select), counted in pixels.
+static const int32_t DIRTY_WINDOW_COST = 64;
+
+static inline int32_t rect_area(const Rect &rect) { return int32_t(rect.w) * int32_t(rect.h); }
+
+static inline int32_t union_area(const Rect &a, const Rect &b) {
+  int32_t w = std::max(a.x2(), b.x2()) - std::min(a.x, b.x);
+  int32_t h = std::max(a.y2(), b.y2()) - std::min(a.y, b.y);
+  return w * h;
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
   this->buffer_ = allocator.allocate(buffer_length);
@@ -20,6 +35,87 @@ void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->clear();
 }
 
+void HOT DisplayBuffer::mark_dirty_(int x, int y) {
+  if (this->dirty_count_ != 0) {
+    // Consecutive pixels are usually drawn next to each other, check the rectangle that grew last first
+    const Rect &last = this->dirty_rects_[this->dirty_last_];
+    if (x >= last.x && x < last.x2() && y >= last.y && y < last.y2())
+      return;
+  }
+
+  Rect pixel(x, y, 1, 1);
+  uint8_t best = 0;
+  int32_t best_growth = INT32_MAX;
+  for (uint8_t i = 0; i < this->dirty_count_; i++) {
+    const Rect &rect = this->dirty_rects_[i];
+    int32_t growth = union_area(rect, pixel) - rect_area(rect);
+    if (growth < best_growth) {
+      best = i;
+      best_growth = growth;
+    }
+  }
+
+  bool grow = this->dirty_count_ == MAX_DIRTY_RECTS;
+  if (!grow && this->dirty_count_ != 0) {
+    const Rect &rect = this->dirty_rects_[best];
+    grow = x >= rect.x - DIRTY_MERGE_DISTANCE && x < rect.x2() + DIRTY_MERGE_DISTANCE &&
+           y >= rect.y - DIRTY_MERGE_DISTANCE && y < rect.y2() + DIRTY_MERGE_DISTANCE;
+  }
+  if (grow) {
+    this->dirty_rects_[best].extend(pixel);
+    this->dirty_last_ = best;
+  } else {
+    this->dirty_last_ = this->dirty_count_++;
+    this->dirty_rects_[this->dirty_last_] = pixel;
+  }
+}
+
+void HOT DisplayBuffer::mark_dirty_span_(int x, int y, int width) {
+  this->mark_dirty_(x, y);
+  if (width > 1)
+    this->dirty_rects_[this->dirty_last_].extend(Rect(x, y, width, 1));
+}
+
+void DisplayBuffer::mark_dirty_all_() {
+  this->dirty_rects_[0] = Rect(0, 0, this->get_width_internal(), this->get_height_internal());
+  this->dirty_count_ = 1;
+  this->dirty_last_ = 0;
+}
+
+void DisplayBuffer::coalesce_dirty_() {
+  bool merged = true;
+  while (merged) {
+    merged = false;
+    for (uint8_t i = 0; i < this->dirty_count_ && !merged; i++) {
+      for (uint8_t j = i + 1; j < this->dirty_count_; j++) {
+        Rect &a = this->dirty_rects_[i];
+        const Rect &b = this->dirty_rects_[j];
+        if (union_area(a, b) > rect_area(a) + rect_area(b) + DIRTY_WINDOW_COST)
+          continue;
+        a.extend(b);
+        this->dirty_rects_[j] = this->dirty_rects_[--this->dirty_count_];
+        merged = true;
+        break;
+      }
+    }
+  }
+
+  // Scattered changes: one window around everything may still be cheaper than the separate ones
+  if (this->dirty_count_ > 1) {
+    Rect bounds = this->dirty_rects_[0];
+    int32_t separate = rect_area(bounds) + DIRTY_WINDOW_COST;
+    for (uint8_t i = 1; i < this->dirty_count_; i++) {
+      bounds.extend(this->dirty_rects_[i]);
+      separate += rect_area(this->dirty_rects_[i]) + DIRTY_WINDOW_COST;
+    }
+    if (rect_area(bounds) + DIRTY_WINDOW_COST <= separate) {
+      this->dirty_rects_[0] = bounds;
+      this->dirty_count_ = 1;
+    }
+  }
+  this->dirty_last_ = 0;
+}
+
 int DisplayBuffer::get_width() {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_90_DEGREES:
@@ -68,5 +164,118 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+bool HOT DisplayBuffer::clip_span_(int &x, int y, int &width) {
+  if (y < 0 || y >= this->get_height())
+    return false;
+  int x1 = std::max(x, 0);
+  int x2 = std::min(x + width, this->get_width());
+  Rect clipping = this->get_clipping();
+  if (clipping.is_set()) {
+    // same bounds as Rect::inside(), which includes x2() and y2()
+    if (y < clipping.y || y > clipping.y2())
+      return false;
+    x1 = std::max(x1, int(clipping.x));
+    x2 = std::min(x2, clipping.x2() + 1);
+  }
+  if (x1 >= x2)
+    return false;
+  x = x1;
+  width = x2 - x1;
+  return true;
+}
+
+void HOT DisplayBuffer::fill_span(int x, int y, int width, Color color) {
+  if (!this->clip_span_(x, y, width))
+    return;
+
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      this->fill_span_internal_(x, y, width, color);
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      // a row on the rotated display is a column in the buffer
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(this->get_width_internal() - y - 1, i, color);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      this->fill_span_internal_(this->get_width_internal() - x - width, this->get_height_internal() - y - 1, width,
+                                color);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      for (int i = x; i < x + width; i++)
+        this->draw_absolute_pixel_internal(y, this->get_height_internal() - i - 1, color);
+      break;
+  }
+  App.feed_wdt();
+}
+
+void HOT DisplayBuffer::blit_rgb565_rows(int x, int y, const uint8_t *data, int width, int height, bool transparent) {
+  if (this->rotation_ != DISPLAY_ROTATION_0_DEGREES) {
+    Display::blit_rgb565_rows(x, y, data, width, height, transparent);
+    return;
+  }
+
+  for (int row = y; row < y + height; row++, data += width * 2) {
+    int span_x = x;
+    int span_width = width;
+    if (!this->clip_span_(span_x, row, span_width))
+      continue;
+    this->blit_rgb565_span_internal_(span_x, row, data + (span_x - x) * 2, span_width, transparent);
+    App.feed_wdt();
+  }
+}
+
+void HOT DisplayBuffer::fill_span_internal_(int x, int y, int width, Color color) {
+  for (int i = x; i < x + width; i++)
+    this->draw_absolute_pixel_internal(i, y, color);
+}
+
+void HOT DisplayBuffer::blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  for (int i = x; i < x + width; i++, data += 2) {
+    const uint16_t rgb565 = progmem_read_byte(data) << 8 | progmem_read_byte(data + 1);
+    if (transparent && rgb565 == 0x0020)
+      continue;
+    this->draw_absolute_pixel_internal(i, y, ColorUtil::rgb565_to_color(rgb565));
+  }
+}
+
+void HOT DisplayBuffer::fill_span_rgb565_(int x, int y, int width, uint16_t color) {
+  const uint8_t high = color >> 8;
+  const uint8_t low = color & 0xFF;
+  uint8_t *pos = this->buffer_ + (y * this->get_width_internal() + x) * 2;
+  int first = -1;
+  int last = -1;
+  for (int i = 0; i < width; i++, pos += 2) {
+    if (pos[0] == high && pos[1] == low)
+      continue;
+    pos[0] = high;
+    pos[1] = low;
+    if (first < 0)
+      first = i;
+    last = i;
+  }
+  if (first >= 0)
+    this->mark_dirty_span_(x + first, y, last - first + 1);
+}
+
+void HOT DisplayBuffer::blit_rgb565_span_rgb565_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  uint8_t *pos = this->buffer_ + (y * this->get_width_internal() + x) * 2;
+  int first = -1;
+  int last = -1;
+  for (int i = 0; i < width; i++, pos += 2, data += 2) {
+    const uint8_t high = progmem_read_byte(data);
+    const uint8_t low = progmem_read_byte(data + 1);
+    if ((transparent && high == 0x00 && low == 0x20) || (pos[0] == high && pos[1] == low))
+      continue;
+    pos[0] = high;
+    pos[1] = low;
+    if (first < 0)
+      first = i;
+    last = i;
+  }
+  if (first >= 0)
+    this->mark_dirty_span_(x + first, y, last - first + 1);
+}
+
 }  // namespace display
 }  // namespace esphome
@@ -5,6 +5,7 @@
 
 #include "display.h"
 #include "display_color_utils.h"
+#include "rect.h"
 
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
@@ -22,6 +23,9 @@ class DisplayBuffer : public Display {
   /// Set a single pixel at the specified coordinates to the given color.
   void draw_pixel_at(int x, int y, Color color) override;
 
+  void fill_span(int x, int y, int width, Color color) override;
+  void blit_rgb565_rows(int x, int y, const uint8_t *data, int width, int height, bool transparent) override;
+
   virtual int get_height_internal() = 0;
   virtual int get_width_internal() = 0;
 
@@ -30,7 +34,44 @@ class DisplayBuffer : public Display {
 
   void init_internal_(uint32_t buffer_length);
 
+  /// Clip the span [x, x + width) on row y to the display and the clipping rectangle, false if nothing is left.
+  bool clip_span_(int &x, int y, int &width);
+
+  /** Fill \p width pixels to the right of the absolute (unrotated) position [x,y], already clipped to the display.
+   *
+   * The default calls draw_absolute_pixel_internal() for every pixel, drivers override it to write their buffer.
+   */
+  virtual void fill_span_internal_(int x, int y, int width, Color color);
+  /// Copy \p width big endian RGB565 pixels from PROGMEM to the absolute position [x,y], already clipped.
+  virtual void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent);
+
+  /// fill_span_internal_() for drivers whose buffer holds big endian RGB565 pixels row after row.
+  void fill_span_rgb565_(int x, int y, int width, uint16_t color);
+  /// blit_rgb565_span_internal_() for drivers whose buffer holds big endian RGB565 pixels row after row.
+  void blit_rgb565_span_rgb565_(int x, int y, const uint8_t *data, int width, bool transparent);
+
+  /** Record that the pixel at the given absolute (unrotated) coordinates changed since the last flush.
+   *
+   * Changed pixels are collected in up to MAX_DIRTY_RECTS rectangles, a pixel close to an existing rectangle
+   * grows that rectangle instead of starting a new one. Drivers that can write a window of the display memory
+   * call this from draw_absolute_pixel_internal() and only transfer dirty_rects_ on the next flush.
+   */
+  void mark_dirty_(int x, int y);
+  /// Record that \p width pixels to the right of the absolute position [x,y] changed.
+  void mark_dirty_span_(int x, int y, int width);
+  /// Mark the whole display as changed, for example after fill().
+  void mark_dirty_all_();
+  /// Merge dirty rectangles that are cheaper to send as one window than separately. Call before a flush.
+  void coalesce_dirty_();
+  /// Forget all dirty rectangles, call after the flush.
+  void clear_dirty_() { this->dirty_count_ = 0; }
+
+  static const uint8_t MAX_DIRTY_RECTS = 4;
+
   uint8_t *buffer_{nullptr};
+  Rect dirty_rects_[MAX_DIRTY_RECTS];
+  uint8_t dirty_count_{0};
+  uint8_t dirty_last_{0};
 };
 
 }  // namespace display
@@ -69,6 +69,13 @@ class ColorUtil {
   static inline Color rgb332_to_color(uint8_t rgb332_color) {
     return to_color((uint32_t) rgb332_color, COLOR_ORDER_RGB, COLOR_BITNESS_332);
   }
+  /// Expand a RGB565 value to an opaque Color, the low bits repeat the high bits so 0xFFFF becomes white.
+  static inline Color rgb565_to_color(uint16_t rgb565_color) {
+    const uint8_t r = (rgb565_color & 0xF800) >> 11;
+    const uint8_t g = (rgb565_color & 0x07E0) >> 5;
+    const uint8_t b = rgb565_color & 0x001F;
+    return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2), 0xFF);
+  }
   static uint8_t color_to_332(Color color, ColorOrder color_order = ColorOrder::COLOR_ORDER_RGB) {
     uint16_t red_color, green_color, blue_color;
 
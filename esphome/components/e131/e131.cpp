@@ -1,12 +1,17 @@
 #include "e131.h"
 #include "e131_addressable_light_effect.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+// Stop waiting for synchronization packets when none arrived for this long (E131_NETWORK_DATA_LOSS_TIMEOUT)
+static const uint32_t SYNC_TIMEOUT_MS = 2500;
 
 E131Component::E131Component() {}
 
@@ -53,25 +58,22 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
   E131Packet packet;
   int universe = 0;
   uint8_t buf[1460];
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
-  }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
-
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
-    return;
-  }
-
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  // Drain everything that arrived since the last loop, large setups send many universes per frame
+  ssize_t len;
+  while ((len = this->socket_->read(buf, sizeof(buf))) != -1) {
+    if (this->packet_(buf, len, universe, packet)) {
+      if (!this->process_(universe, packet)) {
+        ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+      }
+    } else if (this->sync_packet_(buf, len, universe)) {
+      this->process_sync_(universe);
+    } else {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+    }
   }
 }
 
@@ -86,6 +88,7 @@ void E131Component::add_effect(E131AddressableLightEffect *light_effect) {
   light_effects_.insert(light_effect);
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
+    universe_effects_[universe].push_back(light_effect);
     join_(universe);
   }
 }
@@ -101,21 +104,68 @@ void E131Component::remove_effect(E131AddressableLightEffect *light_effect) {
   light_effects_.erase(light_effect);
 
   for (auto universe = light_effect->get_first_universe(); universe <= light_effect->get_last_universe(); ++universe) {
+    auto &effects = universe_effects_[universe];
+    effects.erase(std::remove(effects.begin(), effects.end(), light_effect), effects.end());
+    if (effects.empty())
+      universe_effects_.erase(universe);
     leave_(universe);
   }
+
+  pending_show_.erase(std::remove_if(pending_show_.begin(), pending_show_.end(),
+                                     [light_effect](const std::pair<int, E131AddressableLightEffect *> &pending) {
+                                       return pending.second == light_effect;
+                                     }),
+                      pending_show_.end());
+  if (light_effects_.empty())
+    this->set_sync_universe_(0);
 }
 
 bool E131Component::process_(int universe, const E131Packet &packet) {
-  bool handled = false;
-
   ESP_LOGV(TAG, "Received E1.31 packet for %d universe, with %d bytes", universe, packet.count);
 
-  for (auto *light_effect : light_effects_) {
-    handled = light_effect->process_(universe, packet) || handled;
+  auto effects = universe_effects_.find(universe);
+  if (effects == universe_effects_.end())
+    return false;
+
+  this->set_sync_universe_(packet.sync_address);
+  // Only hold the data back while the source actually sends synchronization packets for it
+  bool hold = packet.sync_address != 0 && packet.sync_address == last_sync_address_ &&
+              millis() - last_sync_time_ < SYNC_TIMEOUT_MS;
+
+  bool handled = false;
+  for (auto *light_effect : effects->second) {
+    if (!light_effect->process_(universe, packet))
+      continue;
+    handled = true;
+
+    if (!hold) {
+      light_effect->show_();
+      continue;
+    }
+    std::pair<int, E131AddressableLightEffect *> pending(packet.sync_address, light_effect);
+    if (std::find(pending_show_.begin(), pending_show_.end(), pending) == pending_show_.end())
+      pending_show_.push_back(pending);
   }
 
   return handled;
 }
 
+void E131Component::process_sync_(int sync_address) {
+  ESP_LOGV(TAG, "Received E1.31 synchronization packet for %d universe", sync_address);
+
+  last_sync_address_ = sync_address;
+  last_sync_time_ = millis();
+
+  auto it = pending_show_.begin();
+  while (it != pending_show_.end()) {
+    if (it->first == sync_address) {
+      it->second->show_();
+      it = pending_show_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
 }  // namespace e131
 }  // namespace esphome
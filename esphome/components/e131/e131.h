@@ -6,6 +6,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace esphome {
@@ -19,7 +20,10 @@ const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  /// Points into the received datagram, so it is only valid while that is processed. values[0] is the start code.
+  const uint8_t *values;
+  /// Universe of the synchronization packet the data waits for, or 0 to show it right away
+  uint16_t sync_address;
 };
 
 class E131Component : public esphome::Component {
@@ -37,8 +41,11 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool sync_packet_(const uint8_t *data, size_t len, int &sync_address);
   bool process_(int universe, const E131Packet &packet);
+  void process_sync_(int sync_address);
+  void set_sync_universe_(int sync_address);
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
@@ -47,7 +54,15 @@ class E131Component : public esphome::Component {
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  /// The effects listening to each universe, so a packet only visits the effects it is meant for
+  std::map<int, std::vector<E131AddressableLightEffect *>> universe_effects_;
+  /// Effects with data waiting for a synchronization packet, with the sync address they wait for
+  std::vector<std::pair<int, E131AddressableLightEffect *>> pending_show_;
+  /// The synchronization universe joined for the received data, 0 if none
+  int sync_universe_{0};
+  /// The sync address and time of the last synchronization packet
+  int last_sync_address_{0};
+  uint32_t last_sync_time_{0};
 };
 
 }  // namespace e131
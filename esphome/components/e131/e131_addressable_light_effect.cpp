@@ -6,7 +6,7 @@ namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131_addressable_light_effect";
-static const int MAX_DATA_SIZE = (sizeof(E131Packet::values) - 1);
+static const int MAX_DATA_SIZE = E131_MAX_PROPERTY_VALUES_COUNT - 1;
 
 E131AddressableLightEffect::E131AddressableLightEffect(const std::string &name) : AddressableLightEffect(name) {}
 
@@ -41,7 +41,7 @@ void E131AddressableLightEffect::stop() {
 }
 
 void E131AddressableLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
-  // ignore, it is run by `E131Component::update()`
+  // ignore, it is run by `E131Component::loop()`
 }
 
 bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet) {
@@ -84,9 +84,10 @@ bool E131AddressableLightEffect::process_(int universe, const E131Packet &packet
       break;
   }
 
-  it->schedule_show();
   return true;
 }
 
+void E131AddressableLightEffect::show_() { this->get_addressable_()->schedule_show(); }
+
 }  // namespace e131
 }  // namespace esphome
@@ -31,6 +31,7 @@ class E131AddressableLightEffect : public light::AddressableLightEffect {
 
  protected:
   bool process_(int universe, const E131Packet &packet);
+  void show_();
 
   int first_universe_{0};
   int last_universe_{0};
@@ -1,6 +1,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/core/preferences.h"
+#include "esphome/core/preference_cache.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include <nvs_flash.h>
@@ -14,45 +15,33 @@ namespace esp32 {
 
 static const char *const TAG = "esp32.preferences";
 
-struct NVSData {
-  std::string key;
-  std::vector<uint8_t> data;
-};
+static PreferenceCache s_pending_save;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static PreferenceWriteBudget s_write_budget;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
-static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static std::string nvs_key(uint32_t type) { return str_sprintf("%" PRIu32, type); }
 
 class ESP32PreferenceBackend : public ESPPreferenceBackend {
  public:
-  std::string key;
+  uint32_t type;
   uint32_t nvs_handle;
   bool save(const uint8_t *data, size_t len) override {
-    // try find in pending saves and update that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        obj.data.assign(data, data + len);
-        return true;
-      }
-    }
-    NVSData save{};
-    save.key = key;
-    save.data.assign(data, data + len);
-    s_pending_save.emplace_back(save);
-    ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %d", key.c_str(), len);
+    s_pending_save.save(type, data, len);
+    ESP_LOGVV(TAG, "s_pending_save: type: %" PRIu32 ", len: %d", type, len);
     return true;
   }
   bool load(uint8_t *data, size_t len) override {
     // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
+    const std::vector<uint8_t> *pending = s_pending_save.get_pending(type);
+    if (pending != nullptr) {
+      if (pending->size() != len) {
+        // size mismatch
+        return false;
       }
+      memcpy(data, pending->data(), len);
+      return true;
     }
 
+    std::string key = nvs_key(type);
     size_t actual_len;
     esp_err_t err = nvs_get_blob(nvs_handle, key.c_str(), nullptr, &actual_len);
     if (err != 0) {
@@ -70,6 +59,8 @@ class ESP32PreferenceBackend : public ESPPreferenceBackend {
     } else {
       ESP_LOGVV(TAG, "nvs_get_blob: key: %s, len: %d", key.c_str(), len);
     }
+    // remember what is in flash, so sync() can skip unchanged values without reading them back
+    s_pending_save.set_stored(type, data, len);
     return true;
   }
 };
@@ -100,51 +91,61 @@ class ESP32Preferences : public ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type) override {
     auto *pref = new ESP32PreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
     pref->nvs_handle = nvs_handle;
-
-    uint32_t keyval = type;
-    pref->key = str_sprintf("%" PRIu32, keyval);
+    pref->type = type;
 
     return ESPPreferenceObject(pref);
   }
 
-  bool sync() override {
+  bool sync() override { return this->sync_(false); }
+  bool sync_within_budget() override { return this->sync_(true); }
+  void set_write_budget(uint32_t max_writes, uint32_t window_ms) override { s_write_budget.set(max_writes, window_ms); }
+
+  bool sync_(bool use_budget) {
     if (s_pending_save.empty())
       return true;
 
-    ESP_LOGD(TAG, "Saving %d preferences to flash...", s_pending_save.size());
+    ESP_LOGD(TAG, "Saving %d preferences to flash...", s_pending_save.pending_count());
     // goal try write all pending saves even if one fails
-    int cached = 0, written = 0, failed = 0;
+    int cached = 0, written = 0, failed = 0, deferred = 0;
     esp_err_t last_err = ESP_OK;
     std::string last_key{};
 
-    // go through vector from back to front (makes erase easier/more efficient)
-    for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", save.key.c_str());
-      if (is_changed(nvs_handle, save)) {
-        esp_err_t err = nvs_set_blob(nvs_handle, save.key.c_str(), save.data.data(), save.data.size());
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
-        if (err != 0) {
-          ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", save.key.c_str(), save.data.size(),
-                   esp_err_to_name(err));
-          failed++;
-          last_err = err;
-          last_key = save.key;
-          continue;
-        }
-        written++;
-      } else {
-        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", save.key.c_str(), save.data.size());
+    for (auto *save : s_pending_save.get_pending_entries()) {
+      std::string key = nvs_key(save->type);
+      ESP_LOGVV(TAG, "Checking if NVS data %s has changed", key.c_str());
+      bool changed =
+          save->stored_crc_valid ? !s_pending_save.is_unchanged(*save) : is_changed(nvs_handle, key, save->data);
+      if (!changed) {
+        ESP_LOGV(TAG, "NVS data not changed skipping %s  len=%u", key.c_str(), save->data.size());
+        s_pending_save.mark_synced(*save);
         cached++;
+        continue;
       }
-      s_pending_save.erase(s_pending_save.begin() + i);
+      if (use_budget && !s_write_budget.consume()) {
+        deferred++;
+        continue;
+      }
+      esp_err_t err = nvs_set_blob(nvs_handle, key.c_str(), save->data.data(), save->data.size());
+      ESP_LOGV(TAG, "sync: key: %s, len: %d", key.c_str(), save->data.size());
+      if (err != 0) {
+        ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key.c_str(), save->data.size(), esp_err_to_name(err));
+        failed++;
+        last_err = err;
+        last_key = key;
+        continue;
+      }
+      s_pending_save.mark_synced(*save);
+      written++;
     }
-    ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed", cached + written + failed, cached,
-             written, failed);
+    ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed, %d deferred",
+             cached + written + failed + deferred, cached, written, failed, deferred);
     if (failed > 0) {
       ESP_LOGE(TAG, "Error saving %d preferences to flash. Last error=%s for key=%s", failed, esp_err_to_name(last_err),
                last_key.c_str());
     }
+    if (deferred > 0) {
+      ESP_LOGW(TAG, "Flash write budget exhausted, deferring %d preferences", deferred);
+    }
 
     // note: commit on esp-idf currently is a no-op, nvs_set_blob always writes
     esp_err_t err = nvs_commit(nvs_handle);
@@ -155,21 +156,22 @@ class ESP32Preferences : public ESPPreferences {
 
     return failed == 0;
   }
-  bool is_changed(const uint32_t nvs_handle, const NVSData &to_save) {
-    NVSData stored_data{};
+  /// Fallback for values of which the CRC in flash is unknown (never loaded or written since boot).
+  bool is_changed(const uint32_t nvs_handle, const std::string &key, const std::vector<uint8_t> &to_save) {
+    std::vector<uint8_t> stored_data;
     size_t actual_len;
-    esp_err_t err = nvs_get_blob(nvs_handle, to_save.key.c_str(), nullptr, &actual_len);
+    esp_err_t err = nvs_get_blob(nvs_handle, key.c_str(), nullptr, &actual_len);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", to_save.key.c_str(), esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_get_blob('%s'): %s - the key might not be set yet", key.c_str(), esp_err_to_name(err));
       return true;
     }
-    stored_data.data.resize(actual_len);
-    err = nvs_get_blob(nvs_handle, to_save.key.c_str(), stored_data.data.data(), &actual_len);
+    stored_data.resize(actual_len);
+    err = nvs_get_blob(nvs_handle, key.c_str(), stored_data.data(), &actual_len);
     if (err != 0) {
-      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", to_save.key.c_str(), esp_err_to_name(err));
+      ESP_LOGV(TAG, "nvs_get_blob('%s') failed: %s", key.c_str(), esp_err_to_name(err));
       return true;
     }
-    return to_save.data != stored_data.data;
+    return to_save != stored_data;
   }
 
   bool reset() override {
@@ -63,6 +63,9 @@ ESP32BLEStopScanAction = esp32_ble_tracker_ns.class_(
     "ESP32BLEStopScanAction", automation.Action
 )
 
+# Apple, the company id in the manufacturer data of iBeacon advertisements
+IBEACON_COMPANY_ID = 0x004C
+
 
 def validate_scan_parameters(config):
     duration = config[CONF_DURATION]
@@ -226,12 +229,16 @@ async def to_code(config):
             addr_list = []
             for it in conf[CONF_MAC_ADDRESS]:
                 addr_list.append(it.as_hex)
+                cg.add(var.add_address_filter(trigger, it.as_hex))
             cg.add(trigger.set_addresses(addr_list))
         await automation.build_automation(trigger, [(ESPBTDeviceConstRef, "x")], conf)
     for conf in config.get(CONF_ON_BLE_SERVICE_DATA_ADVERTISE, []):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         if len(conf[CONF_SERVICE_UUID]) == len(bt_uuid16_format):
             cg.add(trigger.set_service_uuid16(as_hex(conf[CONF_SERVICE_UUID])))
+            cg.add(
+                var.add_service_data_filter(trigger, as_hex(conf[CONF_SERVICE_UUID]))
+            )
         elif len(conf[CONF_SERVICE_UUID]) == len(bt_uuid32_format):
             cg.add(trigger.set_service_uuid32(as_hex(conf[CONF_SERVICE_UUID])))
         elif len(conf[CONF_SERVICE_UUID]) == len(bt_uuid128_format):
@@ -244,6 +251,9 @@ async def to_code(config):
         trigger = cg.new_Pvariable(conf[CONF_TRIGGER_ID], var)
         if len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid16_format):
             cg.add(trigger.set_manufacturer_uuid16(as_hex(conf[CONF_MANUFACTURER_ID])))
+            cg.add(
+                var.add_manufacturer_filter(trigger, as_hex(conf[CONF_MANUFACTURER_ID]))
+            )
         elif len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid32_format):
             cg.add(trigger.set_manufacturer_uuid32(as_hex(conf[CONF_MANUFACTURER_ID])))
         elif len(conf[CONF_MANUFACTURER_ID]) == len(bt_uuid128_format):
@@ -316,9 +326,18 @@ async def esp32_ble_tracker_stop_scan_action_to_code(
 async def register_ble_device(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_listener(var))
+    if mac_address := config.get(CONF_MAC_ADDRESS):
+        # Only that device's advertisements need to be delivered
+        cg.add(paren.add_address_filter(var, mac_address.as_hex))
     return var
 
 
+async def register_manufacturer_filter(var, config, company_id):
+    """Only deliver advertisements with manufacturer data of company_id to var."""
+    paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
+    cg.add(paren.add_manufacturer_filter(var, company_id))
+
+
 async def register_client(var, config):
     paren = await cg.get_variable(config[CONF_ESP32_BLE_ID])
     cg.add(paren.register_client(var))
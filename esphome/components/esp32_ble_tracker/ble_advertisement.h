@@ -0,0 +1,159 @@
+#pragma once
+
+#include "esphome/core/optional.h"
+#include "esphome/core/string_ref.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Only depends on the core headers, so advertisement parsing can be compiled and replayed on the host.
+
+namespace esphome {
+namespace esp32_ble_tracker {
+
+// Advertising data types, see the Generic Access Profile assigned numbers. Same values as ESP_BLE_AD_TYPE_*.
+static const uint8_t AD_TYPE_FLAG = 0x01;
+static const uint8_t AD_TYPE_16SRV_PART = 0x02;
+static const uint8_t AD_TYPE_16SRV_CMPL = 0x03;
+static const uint8_t AD_TYPE_32SRV_PART = 0x04;
+static const uint8_t AD_TYPE_32SRV_CMPL = 0x05;
+static const uint8_t AD_TYPE_128SRV_PART = 0x06;
+static const uint8_t AD_TYPE_128SRV_CMPL = 0x07;
+static const uint8_t AD_TYPE_NAME_SHORT = 0x08;
+static const uint8_t AD_TYPE_NAME_CMPL = 0x09;
+static const uint8_t AD_TYPE_TX_PWR = 0x0A;
+static const uint8_t AD_TYPE_SERVICE_DATA = 0x16;
+static const uint8_t AD_TYPE_APPEARANCE = 0x19;
+static const uint8_t AD_TYPE_INT_RANGE = 0x1A;
+static const uint8_t AD_TYPE_32SERVICE_DATA = 0x20;
+static const uint8_t AD_TYPE_128SERVICE_DATA = 0x21;
+static const uint8_t AD_TYPE_MANUFACTURER_SPECIFIC = 0xFF;
+
+/// A single advertising data structure, pointing into the advertisement it was read from.
+struct BLEAdRecord {
+  uint8_t type;
+  uint8_t length;
+  const uint8_t *data;
+
+  /// Read a little endian 16-bit value at \p offset, which must be at least 2 bytes before the end.
+  uint16_t get_uint16(size_t offset) const { return this->data[offset] | (this->data[offset + 1] << 8); }
+  /// Read a little endian 32-bit value at \p offset, which must be at least 4 bytes before the end.
+  uint32_t get_uint32(size_t offset) const {
+    return uint32_t(this->get_uint16(offset)) | (uint32_t(this->get_uint16(offset + 2)) << 16);
+  }
+};
+
+/** Non-owning view of the advertising data (and scan response) of a BLE scan result.
+ *
+ * Records are decoded while iterating, straight from the received bytes, so nothing is copied or allocated. The view
+ * is only valid as long as the bytes it points to. Zero length fields are skipped as padding, and a record that
+ * doesn't fit in the data ends the iteration.
+ */
+class BLEAdvertisementView {
+ public:
+  class Iterator {
+   public:
+    Iterator(const uint8_t *pos, const uint8_t *end) : pos_(pos), end_(end) { this->skip_(); }
+
+    BLEAdRecord operator*() const {
+      return BLEAdRecord{this->pos_[1], static_cast<uint8_t>(this->pos_[0] - 1), this->pos_ + 2};
+    }
+    Iterator &operator++() {
+      this->pos_ += 1 + this->pos_[0];
+      this->skip_();
+      return *this;
+    }
+    bool operator==(const Iterator &other) const { return this->pos_ == other.pos_; }
+    bool operator!=(const Iterator &other) const { return this->pos_ != other.pos_; }
+
+   protected:
+    void skip_() {
+      while (this->pos_ < this->end_ && *this->pos_ == 0)
+        this->pos_++;
+      if (this->pos_ >= this->end_ || this->end_ - this->pos_ < 1 + *this->pos_)
+        this->pos_ = this->end_;
+    }
+
+    const uint8_t *pos_;
+    const uint8_t *end_;
+  };
+
+  BLEAdvertisementView() = default;
+  BLEAdvertisementView(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+
+  Iterator begin() const { return Iterator(this->data_, this->data_ + this->length_); }
+  Iterator end() const { return Iterator(this->data_ + this->length_, this->data_ + this->length_); }
+
+  const uint8_t *data() const { return this->data_; }
+  size_t size() const { return this->length_; }
+
+  /// The first record of type \p type.
+  optional<BLEAdRecord> find(uint8_t type) const {
+    for (const BLEAdRecord &record : *this) {
+      if (record.type == type)
+        return record;
+    }
+    return {};
+  }
+
+  /// The longest of the complete and shortened local names, empty if there is none.
+  StringRef get_name() const {
+    StringRef name;
+    for (const BLEAdRecord &record : *this) {
+      if ((record.type == AD_TYPE_NAME_SHORT || record.type == AD_TYPE_NAME_CMPL) && record.length > name.size())
+        name = StringRef(record.data, record.length);
+    }
+    return name;
+  }
+  optional<uint8_t> get_ad_flag() const {
+    optional<uint8_t> flag;
+    for (const BLEAdRecord &record : *this) {
+      if (record.type == AD_TYPE_FLAG && record.length >= 1)
+        flag = record.data[0];
+    }
+    return flag;
+  }
+  optional<uint16_t> get_appearance() const {
+    optional<uint16_t> appearance;
+    for (const BLEAdRecord &record : *this) {
+      if (record.type == AD_TYPE_APPEARANCE && record.length >= 2)
+        appearance = record.get_uint16(0);
+    }
+    return appearance;
+  }
+  /// Whether the 16-bit service UUID \p uuid is listed in the complete or incomplete service UUIDs.
+  bool has_service_uuid16(uint16_t uuid) const {
+    for (const BLEAdRecord &record : *this) {
+      if (record.type != AD_TYPE_16SRV_CMPL && record.type != AD_TYPE_16SRV_PART)
+        continue;
+      for (size_t i = 0; i + 2 <= record.length; i += 2) {
+        if (record.get_uint16(i) == uuid)
+          return true;
+      }
+    }
+    return false;
+  }
+  /// The first manufacturer specific data of company \p company_id, without the company id.
+  optional<BLEAdRecord> get_manufacturer_data(uint16_t company_id) const {
+    return this->find_prefixed_(AD_TYPE_MANUFACTURER_SPECIFIC, company_id);
+  }
+  /// The first service data for the 16-bit service UUID \p uuid, without the UUID.
+  optional<BLEAdRecord> get_service_data16(uint16_t uuid) const {
+    return this->find_prefixed_(AD_TYPE_SERVICE_DATA, uuid);
+  }
+
+ protected:
+  optional<BLEAdRecord> find_prefixed_(uint8_t type, uint16_t prefix) const {
+    for (const BLEAdRecord &record : *this) {
+      if (record.type == type && record.length >= 2 && record.get_uint16(0) == prefix)
+        return BLEAdRecord{record.type, static_cast<uint8_t>(record.length - 2), record.data + 2};
+    }
+    return {};
+  }
+
+  const uint8_t *data_{nullptr};
+  size_t length_{0};
+};
+
+}  // namespace esp32_ble_tracker
+}  // namespace esphome
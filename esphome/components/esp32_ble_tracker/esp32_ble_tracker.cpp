@@ -15,6 +15,7 @@
 #include <freertos/FreeRTOSConfig.h>
 #include <freertos/task.h>
 #include <nvs_flash.h>
+#include <algorithm>
 #include <cinttypes>
 
 #ifdef USE_OTA
@@ -33,6 +34,10 @@ namespace esp32_ble_tracker {
 
 static const char *const TAG = "esp32_ble_tracker";
 
+static_assert(AD_TYPE_NAME_CMPL == ESP_BLE_AD_TYPE_NAME_CMPL && AD_TYPE_SERVICE_DATA == ESP_BLE_AD_TYPE_SERVICE_DATA &&
+                  AD_TYPE_MANUFACTURER_SPECIFIC == ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE,
+              "Advertising data types must match esp-idf");
+
 ESP32BLETracker *global_esp32_ble_tracker = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 float ESP32BLETracker::get_setup_priority() const { return setup_priority::AFTER_BLUETOOTH; }
@@ -123,8 +128,9 @@ void ESP32BLETracker::loop() {
           device.parse_scan_rst(this->scan_result_buffer_[i]);
 
           bool found = false;
-          for (auto *listener : this->listeners_) {
-            if (listener->parse_device(device))
+          this->match_listeners_(device);
+          for (uint16_t listener : this->matched_listeners_) {
+            if (this->listeners_[listener]->parse_device(device))
               found = true;
           }
 
@@ -291,9 +297,88 @@ void ESP32BLETracker::register_client(ESPBTClient *client) {
 void ESP32BLETracker::register_listener(ESPBTDeviceListener *listener) {
   listener->set_parent(this);
   this->listeners_.push_back(listener);
+  this->unfiltered_dirty_ = true;
   this->recalculate_advertisement_parser_types();
 }
 
+template<typename K>
+void ESP32BLETracker::add_filter_(std::vector<std::pair<K, uint16_t>> &index, ESPBTDeviceListener *listener, K key) {
+  auto it = std::find(this->listeners_.begin(), this->listeners_.end(), listener);
+  if (it == this->listeners_.end()) {
+    // the listener gets all advertisements once it's registered, which is always safe
+    ESP_LOGW(TAG, "Ignoring dispatch filter of a listener that isn't registered");
+    return;
+  }
+  const std::pair<K, uint16_t> entry(key, it - this->listeners_.begin());
+  index.insert(std::upper_bound(index.begin(), index.end(), entry), entry);
+  this->unfiltered_dirty_ = true;
+}
+
+void ESP32BLETracker::add_address_filter(ESPBTDeviceListener *listener, uint64_t address) {
+  this->add_filter_(this->address_filters_, listener, address);
+}
+
+void ESP32BLETracker::add_service_data_filter(ESPBTDeviceListener *listener, uint16_t uuid) {
+  this->add_filter_(this->service_data_filters_, listener, uuid);
+}
+
+void ESP32BLETracker::add_manufacturer_filter(ESPBTDeviceListener *listener, uint16_t company_id) {
+  this->add_filter_(this->manufacturer_filters_, listener, company_id);
+}
+
+template<typename K>
+static void append_filter_matches(const std::vector<std::pair<K, uint16_t>> &index, K key,
+                                  std::vector<uint16_t> &matches) {
+  auto it = std::lower_bound(index.begin(), index.end(), std::pair<K, uint16_t>(key, 0));
+  for (; it != index.end() && it->first == key; ++it)
+    matches.push_back(it->second);
+}
+
+void ESP32BLETracker::match_listeners_(const ESPBTDevice &device) {
+  if (this->unfiltered_dirty_) {
+    std::vector<bool> filtered(this->listeners_.size(), false);
+    for (auto &it : this->address_filters_)
+      filtered[it.second] = true;
+    for (auto &it : this->service_data_filters_)
+      filtered[it.second] = true;
+    for (auto &it : this->manufacturer_filters_)
+      filtered[it.second] = true;
+    this->unfiltered_listeners_.clear();
+    for (size_t i = 0; i < this->listeners_.size(); i++) {
+      if (!filtered[i])
+        this->unfiltered_listeners_.push_back(i);
+    }
+    this->unfiltered_dirty_ = false;
+  }
+
+  auto &matched = this->matched_listeners_;
+  matched = this->unfiltered_listeners_;
+  const size_t unfiltered = matched.size();
+
+  append_filter_matches(this->address_filters_, device.address_uint64(), matched);
+  bool other_service_data = false;
+  for (const BLEAdRecord &record : device.get_advertisement()) {
+    if (record.type == AD_TYPE_SERVICE_DATA && record.length >= 2) {
+      append_filter_matches(this->service_data_filters_, record.get_uint16(0), matched);
+    } else if (record.type == AD_TYPE_32SERVICE_DATA || record.type == AD_TYPE_128SERVICE_DATA) {
+      other_service_data = true;
+    } else if (record.type == AD_TYPE_MANUFACTURER_SPECIFIC && record.length >= 2) {
+      append_filter_matches(this->manufacturer_filters_, record.get_uint16(0), matched);
+    }
+  }
+  if (other_service_data) {
+    // ESPBTUUID compares equal across sizes, so a 32 or 128-bit UUID may still match a 16-bit filter
+    for (auto &it : this->service_data_filters_)
+      matched.push_back(it.second);
+  }
+
+  if (matched.size() > unfiltered) {
+    // keep registration order and call each listener only once
+    std::sort(matched.begin(), matched.end());
+    matched.erase(std::unique(matched.begin(), matched.end()), matched.end());
+  }
+}
+
 void ESP32BLETracker::recalculate_advertisement_parser_types() {
   this->raw_advertisements_ = false;
   this->parse_advertisements_ = false;
@@ -389,7 +474,14 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
     this->address_[i] = param.bda[i];
   this->address_type_ = param.ble_addr_type;
   this->rssi_ = param.rssi;
-  this->parse_adv_(param);
+  this->parsed_ = 0;
+  this->name_.clear();
+  this->tx_powers_.clear();
+  this->appearance_.reset();
+  this->ad_flag_.reset();
+  this->service_uuids_.clear();
+  this->manufacturer_datas_.clear();
+  this->service_datas_.clear();
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   ESP_LOGVV(TAG, "Parse Result:");
@@ -412,20 +504,20 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
             this->address_[2], this->address_[3], this->address_[4], this->address_[5], address_type);
 
   ESP_LOGVV(TAG, "  RSSI: %d", this->rssi_);
-  ESP_LOGVV(TAG, "  Name: '%s'", this->name_.c_str());
-  for (auto &it : this->tx_powers_) {
+  ESP_LOGVV(TAG, "  Name: '%s'", this->get_name().c_str());
+  for (auto &it : this->get_tx_powers()) {
     ESP_LOGVV(TAG, "  TX Power: %d", it);
   }
-  if (this->appearance_.has_value()) {
-    ESP_LOGVV(TAG, "  Appearance: %u", *this->appearance_);
+  if (this->get_appearance().has_value()) {
+    ESP_LOGVV(TAG, "  Appearance: %u", *this->get_appearance());
   }
-  if (this->ad_flag_.has_value()) {
-    ESP_LOGVV(TAG, "  Ad Flag: %u", *this->ad_flag_);
+  if (this->get_ad_flag().has_value()) {
+    ESP_LOGVV(TAG, "  Ad Flag: %u", *this->get_ad_flag());
   }
-  for (auto &uuid : this->service_uuids_) {
+  for (auto &uuid : this->get_service_uuids()) {
     ESP_LOGVV(TAG, "  Service UUID: %s", uuid.to_string().c_str());
   }
-  for (auto &data : this->manufacturer_datas_) {
+  for (auto &data : this->get_manufacturer_datas()) {
     ESP_LOGVV(TAG, "  Manufacturer data: %s", format_hex_pretty(data.data).c_str());
     if (this->get_ibeacon().has_value()) {
       auto ibeacon = this->get_ibeacon().value();
@@ -436,7 +528,7 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
       ESP_LOGVV(TAG, "      TXPower: %d", ibeacon.get_signal_power());
     }
   }
-  for (auto &data : this->service_datas_) {
+  for (auto &data : this->get_service_datas()) {
     ESP_LOGVV(TAG, "  Service data:");
     ESP_LOGVV(TAG, "    UUID: %s", data.uuid.to_string().c_str());
     ESP_LOGVV(TAG, "    Data: %s", format_hex_pretty(data.data).c_str());
@@ -445,30 +537,23 @@ void ESPBTDevice::parse_scan_rst(const esp_ble_gap_cb_param_t::ble_scan_result_e
   ESP_LOGVV(TAG, "Adv data: %s", format_hex_pretty(param.ble_adv, param.adv_data_len + param.scan_rsp_len).c_str());
 #endif
 }
-void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param) {
-  size_t offset = 0;
-  const uint8_t *payload = param.ble_adv;
-  uint8_t len = param.adv_data_len + param.scan_rsp_len;
-
-  while (offset + 2 < len) {
-    const uint8_t field_length = payload[offset++];  // First byte is length of adv record
-    if (field_length == 0) {
-      continue;  // Possible zero padded advertisement data
-    }
-
-    // first byte of adv record is adv record type
-    const uint8_t record_type = payload[offset++];
-    const uint8_t *record = &payload[offset];
-    const uint8_t record_length = field_length - 1;
-    offset += record_length;
+void ESPBTDevice::parse_adv_(uint8_t fields) const {
+  fields &= ~this->parsed_;
+  if (fields == 0)
+    return;
+  // only log unhandled records on the first pass over the advertisement
+  const bool first_pass = this->parsed_ == 0;
+  this->parsed_ |= fields;
 
+  for (const BLEAdRecord &record : this->get_advertisement()) {
+    const uint8_t record_length = record.length;
     // See also Generic Access Profile Assigned Numbers:
     // https://www.bluetooth.com/specifications/assigned-numbers/generic-access-profile/ See also ADVERTISING AND SCAN
     // RESPONSE DATA FORMAT: https://www.bluetooth.com/specifications/bluetooth-core-specification/ (vol 3, part C, 11)
     // See also Core Specification Supplement: https://www.bluetooth.com/specifications/bluetooth-core-specification/
     // (called CSS here)
 
-    switch (record_type) {
+    switch (record.type) {
       case ESP_BLE_AD_TYPE_NAME_SHORT:
       case ESP_BLE_AD_TYPE_NAME_CMPL: {
         // CSS 1.2 LOCAL NAME
@@ -477,8 +562,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // SHORTENED LOCAL NAME
         // "The Shortened Local Name data type defines a shortened version of the Local Name data type. The Shortened
         // Local Name data type shall not be used to advertise a name that is longer than the Local Name data type."
-        if (record_length > this->name_.length()) {
-          this->name_ = std::string(reinterpret_cast<const char *>(record), record_length);
+        if ((fields & PARSED_NAME) && record_length > this->name_.length()) {
+          this->name_ = std::string(reinterpret_cast<const char *>(record.data), record_length);
         }
         break;
       }
@@ -486,7 +571,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // CSS 1.5 TX POWER LEVEL
         // "The TX Power Level data type indicates the transmitted power level of the packet containing the data type."
         // CSS 1: Optional in this context (may appear more than once in a block).
-        this->tx_powers_.push_back(*payload);
+        if ((fields & PARSED_TX_POWERS) && record_length >= 1)
+          this->tx_powers_.push_back(static_cast<int8_t>(record.data[0]));
         break;
       }
       case ESP_BLE_AD_TYPE_APPEARANCE: {
@@ -495,7 +581,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // See also https://www.bluetooth.com/specifications/gatt/characteristics/
         // CSS 1: Optional in this context; shall not appear more than once in a block and shall not appear in both
         // the AD and SRD of the same extended advertising interval.
-        this->appearance_ = *reinterpret_cast<const uint16_t *>(record);
+        if ((fields & PARSED_APPEARANCE) && record_length >= 2)
+          this->appearance_ = record.get_uint16(0);
         break;
       }
       case ESP_BLE_AD_TYPE_FLAG: {
@@ -504,7 +591,8 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // Flag bits are non-zero and the advertising packet is connectable, otherwise the Flags data type may be
         // omitted."
         // CSS 1: Optional in this context; shall not appear more than once in a block.
-        this->ad_flag_ = *record;
+        if ((fields & PARSED_AD_FLAG) && record_length >= 1)
+          this->ad_flag_ = record.data[0];
         break;
       }
       // CSS 1.1 SERVICE UUID
@@ -514,23 +602,31 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
       case ESP_BLE_AD_TYPE_16SRV_CMPL:
       case ESP_BLE_AD_TYPE_16SRV_PART: {
         // • 16-bit Bluetooth Service UUIDs
+        if (!(fields & PARSED_SERVICE_UUIDS))
+          break;
         for (uint8_t i = 0; i < record_length / 2; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record + 2 * i)));
+          this->service_uuids_.push_back(ESPBTUUID::from_uint16(record.get_uint16(2 * i)));
         }
         break;
       }
       case ESP_BLE_AD_TYPE_32SRV_CMPL:
       case ESP_BLE_AD_TYPE_32SRV_PART: {
         // • 32-bit Bluetooth Service UUIDs
+        if (!(fields & PARSED_SERVICE_UUIDS))
+          break;
         for (uint8_t i = 0; i < record_length / 4; i++) {
-          this->service_uuids_.push_back(ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record + 4 * i)));
+          this->service_uuids_.push_back(ESPBTUUID::from_uint32(record.get_uint32(4 * i)));
         }
         break;
       }
       case ESP_BLE_AD_TYPE_128SRV_CMPL:
       case ESP_BLE_AD_TYPE_128SRV_PART: {
         // • Global 128-bit Service UUIDs
-        this->service_uuids_.push_back(ESPBTUUID::from_raw(record));
+        if (!(fields & PARSED_SERVICE_UUIDS))
+          break;
+        for (uint8_t i = 0; i < record_length / 16; i++) {
+          this->service_uuids_.push_back(ESPBTUUID::from_raw(record.data + 16 * i));
+        }
         break;
       }
       case ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE: {
@@ -539,13 +635,15 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // contain a company identifier from Assigned Numbers. The interpretation of any other octets within the data
         // shall be defined by the manufacturer specified by the company identifier."
         // CSS 1: Optional in this context (may appear more than once in a block).
+        if (!(fields & PARSED_MANUFACTURER_DATAS))
+          break;
         if (record_length < 2) {
           ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_MANUFACTURER_SPECIFIC_TYPE");
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
+        data.uuid = ESPBTUUID::from_uint16(record.get_uint16(0));
+        data.data.assign(record.data + 2UL, record.data + record_length);
         this->manufacturer_datas_.push_back(data);
         break;
       }
@@ -557,13 +655,15 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // «Service Data - 16 bit UUID»
         // Size: 2 or more octets
         // The first 2 octets contain the 16 bit Service UUID fol- lowed by additional service data
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         if (record_length < 2) {
           ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_SERVICE_DATA");
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint16(*reinterpret_cast<const uint16_t *>(record));
-        data.data.assign(record + 2UL, record + record_length);
+        data.uuid = ESPBTUUID::from_uint16(record.get_uint16(0));
+        data.data.assign(record.data + 2UL, record.data + record_length);
         this->service_datas_.push_back(data);
         break;
       }
@@ -571,13 +671,15 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // «Service Data - 32 bit UUID»
         // Size: 4 or more octets
         // The first 4 octets contain the 32 bit Service UUID fol- lowed by additional service data
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         if (record_length < 4) {
           ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_32SERVICE_DATA");
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_uint32(*reinterpret_cast<const uint32_t *>(record));
-        data.data.assign(record + 4UL, record + record_length);
+        data.uuid = ESPBTUUID::from_uint32(record.get_uint32(0));
+        data.data.assign(record.data + 4UL, record.data + record_length);
         this->service_datas_.push_back(data);
         break;
       }
@@ -585,13 +687,15 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // «Service Data - 128 bit UUID»
         // Size: 16 or more octets
         // The first 16 octets contain the 128 bit Service UUID followed by additional service data
+        if (!(fields & PARSED_SERVICE_DATAS))
+          break;
         if (record_length < 16) {
           ESP_LOGV(TAG, "Record length too small for ESP_BLE_AD_TYPE_128SERVICE_DATA");
           break;
         }
         ServiceData data{};
-        data.uuid = ESPBTUUID::from_raw(record);
-        data.data.assign(record + 16UL, record + record_length);
+        data.uuid = ESPBTUUID::from_raw(record.data);
+        data.data.assign(record.data + 16UL, record.data + record_length);
         this->service_datas_.push_back(data);
         break;
       }
@@ -599,12 +703,22 @@ void ESPBTDevice::parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_p
         // Avoid logging this as it's very verbose
         break;
       default: {
-        ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record_type);
+        if (first_pass)
+          ESP_LOGV(TAG, "Unhandled type: advType: 0x%02x", record.type);
         break;
       }
     }
   }
 }
+optional<ESPBLEiBeacon> ESPBTDevice::get_ibeacon() const {
+  // Straight from the advertisement, so presence checks don't need to copy out every manufacturer data
+  for (const BLEAdRecord &record : this->get_advertisement()) {
+    // Apple's company id, followed by the 23 bytes of beacon data
+    if (record.type == AD_TYPE_MANUFACTURER_SPECIFIC && record.length == 25 && record.get_uint16(0) == 0x004C)
+      return ESPBLEiBeacon(record.data + 2);
+  }
+  return {};
+}
 std::string ESPBTDevice::address_str() const {
   char mac[24];
   snprintf(mac, sizeof(mac), "%02X:%02X:%02X:%02X:%02X:%02X", this->address_[0], this->address_[1], this->address_[2],
@@ -624,11 +738,10 @@ void ESP32BLETracker::dump_config() {
 
 void ESP32BLETracker::print_bt_device_info(const ESPBTDevice &device) {
   const uint64_t address = device.address_uint64();
-  for (auto &disc : this->already_discovered_) {
-    if (disc == address)
-      return;
-  }
-  this->already_discovered_.push_back(address);
+  auto it = std::lower_bound(this->already_discovered_.begin(), this->already_discovered_.end(), address);
+  if (it != this->already_discovered_.end() && *it == address)
+    return;
+  this->already_discovered_.insert(it, address);
 
   ESP_LOGD(TAG, "Found device %s RSSI=%d", device.address_str().c_str(), device.get_rssi());
 
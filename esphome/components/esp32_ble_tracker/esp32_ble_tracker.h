@@ -6,6 +6,7 @@
 
 #include <array>
 #include <string>
+#include <utility>
 #include <vector>
 
 #ifdef USE_ESP32
@@ -20,6 +21,8 @@
 #include "esphome/components/esp32_ble/ble.h"
 #include "esphome/components/esp32_ble/ble_uuid.h"
 
+#include "ble_advertisement.h"
+
 namespace esphome {
 namespace esp32_ble_tracker {
 
@@ -71,44 +74,79 @@ class ESPBTDevice {
 
   esp_ble_addr_type_t get_address_type() const { return this->address_type_; }
   int get_rssi() const { return rssi_; }
-  const std::string &get_name() const { return this->name_; }
 
-  const std::vector<int8_t> &get_tx_powers() const { return tx_powers_; }
+  /// The raw advertising data, for listeners that only need to look at a few records.
+  BLEAdvertisementView get_advertisement() const {
+    return BLEAdvertisementView(this->scan_result_.ble_adv,
+                                this->scan_result_.adv_data_len + this->scan_result_.scan_rsp_len);
+  }
+
+  // The decoded fields are only parsed from the advertisement when first requested.
+  const std::string &get_name() const {
+    this->parse_adv_(PARSED_NAME);
+    return this->name_;
+  }
 
-  const optional<uint16_t> &get_appearance() const { return appearance_; }
-  const optional<uint8_t> &get_ad_flag() const { return ad_flag_; }
-  const std::vector<ESPBTUUID> &get_service_uuids() const { return service_uuids_; }
+  const std::vector<int8_t> &get_tx_powers() const {
+    this->parse_adv_(PARSED_TX_POWERS);
+    return tx_powers_;
+  }
+
+  const optional<uint16_t> &get_appearance() const {
+    this->parse_adv_(PARSED_APPEARANCE);
+    return appearance_;
+  }
+  const optional<uint8_t> &get_ad_flag() const {
+    this->parse_adv_(PARSED_AD_FLAG);
+    return ad_flag_;
+  }
+  const std::vector<ESPBTUUID> &get_service_uuids() const {
+    this->parse_adv_(PARSED_SERVICE_UUIDS);
+    return service_uuids_;
+  }
 
-  const std::vector<ServiceData> &get_manufacturer_datas() const { return manufacturer_datas_; }
+  const std::vector<ServiceData> &get_manufacturer_datas() const {
+    this->parse_adv_(PARSED_MANUFACTURER_DATAS);
+    return manufacturer_datas_;
+  }
 
-  const std::vector<ServiceData> &get_service_datas() const { return service_datas_; }
+  const std::vector<ServiceData> &get_service_datas() const {
+    this->parse_adv_(PARSED_SERVICE_DATAS);
+    return service_datas_;
+  }
 
   const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &get_scan_result() const { return scan_result_; }
 
-  optional<ESPBLEiBeacon> get_ibeacon() const {
-    for (auto &it : this->manufacturer_datas_) {
-      auto res = ESPBLEiBeacon::from_manufacturer_data(it);
-      if (res.has_value())
-        return *res;
-    }
-    return {};
-  }
+  optional<ESPBLEiBeacon> get_ibeacon() const;
 
  protected:
-  void parse_adv_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
+  enum ParsedField : uint8_t {
+    PARSED_NAME = 1 << 0,
+    PARSED_TX_POWERS = 1 << 1,
+    PARSED_APPEARANCE = 1 << 2,
+    PARSED_AD_FLAG = 1 << 3,
+    PARSED_SERVICE_UUIDS = 1 << 4,
+    PARSED_MANUFACTURER_DATAS = 1 << 5,
+    PARSED_SERVICE_DATAS = 1 << 6,
+  };
+
+  /// Decode the \p fields that haven't been decoded yet.
+  void parse_adv_(uint8_t fields) const;
 
   esp_bd_addr_t address_{
       0,
   };
   esp_ble_addr_type_t address_type_{BLE_ADDR_TYPE_PUBLIC};
   int rssi_{0};
-  std::string name_{};
-  std::vector<int8_t> tx_powers_{};
-  optional<uint16_t> appearance_{};
-  optional<uint8_t> ad_flag_{};
-  std::vector<ESPBTUUID> service_uuids_{};
-  std::vector<ServiceData> manufacturer_datas_{};
-  std::vector<ServiceData> service_datas_{};
+  /// Bitmask of ParsedField that have been decoded.
+  mutable uint8_t parsed_{0};
+  mutable std::string name_{};
+  mutable std::vector<int8_t> tx_powers_{};
+  mutable optional<uint16_t> appearance_{};
+  mutable optional<uint8_t> ad_flag_{};
+  mutable std::vector<ESPBTUUID> service_uuids_{};
+  mutable std::vector<ServiceData> manufacturer_datas_{};
+  mutable std::vector<ServiceData> service_datas_{};
   esp_ble_gap_cb_param_t::ble_scan_result_evt_param scan_result_{};
 };
 
@@ -194,6 +232,17 @@ class ESP32BLETracker : public Component, public GAPEventHandler, public GATTcEv
 
   void register_listener(ESPBTDeviceListener *listener);
   void register_client(ESPBTClient *client);
+  /** Only deliver advertisements from \p address to the registered \p listener.
+   *
+   * A listener with filters is only called for advertisements matching at least one of them, which are looked up in
+   * an index instead of asking every listener. Listeners without filters get all advertisements. Filters only need to
+   * be a superset of what parse_device() accepts, the listener still checks each advertisement itself.
+   */
+  void add_address_filter(ESPBTDeviceListener *listener, uint64_t address);
+  /// Only deliver advertisements with service data for the 16-bit \p uuid to \p listener, see add_address_filter().
+  void add_service_data_filter(ESPBTDeviceListener *listener, uint16_t uuid);
+  /// Only deliver advertisements with manufacturer data of \p company_id to \p listener, see add_address_filter().
+  void add_manufacturer_filter(ESPBTDeviceListener *listener, uint16_t company_id);
   void recalculate_advertisement_parser_types();
 
   void print_bt_device_info(const ESPBTDevice &device);
@@ -210,6 +259,11 @@ class ESP32BLETracker : public Component, public GAPEventHandler, public GATTcEv
   void start_scan_(bool first);
   /// Called when a scan ends
   void end_of_scan_();
+  /// Add a dispatch filter entry for \p listener to \p index, keeping it sorted by key.
+  template<typename K>
+  void add_filter_(std::vector<std::pair<K, uint16_t>> &index, ESPBTDeviceListener *listener, K key);
+  /// Collect the indices of the listeners that may match \p device into matched_listeners_, in registration order.
+  void match_listeners_(const ESPBTDevice &device);
   /// Called when a `ESP_GAP_BLE_SCAN_RESULT_EVT` event is received.
   void gap_scan_result_(const esp_ble_gap_cb_param_t::ble_scan_result_evt_param &param);
   /// Called when a `ESP_GAP_BLE_SCAN_PARAM_SET_COMPLETE_EVT` event is received.
@@ -221,9 +275,18 @@ class ESP32BLETracker : public Component, public GAPEventHandler, public GATTcEv
 
   int app_id_;
 
-  /// Vector of addresses that have already been printed in print_bt_device_info
+  /// Sorted addresses that have already been printed in print_bt_device_info
   std::vector<uint64_t> already_discovered_;
   std::vector<ESPBTDeviceListener *> listeners_;
+  // Dispatch index: filter keys with the index into listeners_ of the listener, sorted by key
+  std::vector<std::pair<uint64_t, uint16_t>> address_filters_;
+  std::vector<std::pair<uint16_t, uint16_t>> service_data_filters_;
+  std::vector<std::pair<uint16_t, uint16_t>> manufacturer_filters_;
+  /// Indices of the listeners without any filter, rebuilt when unfiltered_dirty_ is set.
+  std::vector<uint16_t> unfiltered_listeners_;
+  bool unfiltered_dirty_{true};
+  /// Scratch list of listener indices for the advertisement being dispatched.
+  std::vector<uint16_t> matched_listeners_;
   /// Client parameters.
   std::vector<ESPBTClient *> clients_;
   /// A structure holding the ESP BLE scan parameters.
@@ -9,6 +9,7 @@ extern "C" {
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include "esphome/core/preferences.h"
+#include "esphome/core/preference_cache.h"
 #include "preferences.h"
 
 #include <cstring>
@@ -23,6 +24,10 @@ static bool s_prevent_write = false;         // NOLINT(cppcoreguidelines-avoid-n
 static uint32_t *s_flash_storage = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static bool s_flash_dirty = false;           // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+/// CRC-32 of the flash sector contents, to drop saves that restored the previous value.
+static uint32_t s_flash_crc = 0;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static PreferenceWriteBudget s_write_budget;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 static const uint32_t ESP_RTC_USER_MEM_START = 0x60001200;
 #define ESP_RTC_USER_MEM ((uint32_t *) ESP_RTC_USER_MEM_START)
 static const uint32_t ESP_RTC_USER_MEM_SIZE_WORDS = 128;
@@ -175,6 +180,7 @@ class ESP8266Preferences : public ESPPreferences {
       InterruptLock lock;
       spi_flash_read(get_esp8266_flash_address(), s_flash_storage, ESP8266_FLASH_STORAGE_SIZE * 4);
     }
+    s_flash_crc = crc32(reinterpret_cast<const uint8_t *>(s_flash_storage), ESP8266_FLASH_STORAGE_SIZE * 4);
   }
 
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
@@ -229,12 +235,27 @@ class ESP8266Preferences : public ESPPreferences {
 #endif
   }
 
-  bool sync() override {
+  bool sync() override { return this->sync_(false); }
+  bool sync_within_budget() override { return this->sync_(true); }
+  void set_write_budget(uint32_t max_writes, uint32_t window_ms) override { s_write_budget.set(max_writes, window_ms); }
+
+  bool sync_(bool use_budget) {
     if (!s_flash_dirty)
       return true;
     if (s_prevent_write)
       return false;
 
+    const uint32_t crc = crc32(reinterpret_cast<const uint8_t *>(s_flash_storage), ESP8266_FLASH_STORAGE_SIZE * 4);
+    if (crc == s_flash_crc) {
+      ESP_LOGV(TAG, "Preferences not changed, skipping flash write");
+      s_flash_dirty = false;
+      return true;
+    }
+    if (use_budget && !s_write_budget.consume()) {
+      ESP_LOGW(TAG, "Flash write budget exhausted, deferring preferences save");
+      return true;
+    }
+
     ESP_LOGD(TAG, "Saving preferences to flash...");
     SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
     {
@@ -254,6 +275,7 @@ class ESP8266Preferences : public ESPPreferences {
     }
 
     s_flash_dirty = false;
+    s_flash_crc = crc;
     return true;
   }
 
@@ -245,6 +245,8 @@ DEFAULT_GLYPHS = (
     ' !"%()+=,-.:/0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz°'
 )
 CONF_RAW_GLYPH_ID = "raw_glyph_id"
+CONF_GLYPH_CACHE = "glyph_cache"
+CONF_TEXT_CACHE_SIZE = "text_cache_size"
 
 FONT_SCHEMA = cv.Schema(
     {
@@ -252,6 +254,8 @@ FONT_SCHEMA = cv.Schema(
         cv.Required(CONF_FILE): FILE_SCHEMA,
         cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
         cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
+        cv.Optional(CONF_GLYPH_CACHE, default=False): cv.boolean,
+        cv.Optional(CONF_TEXT_CACHE_SIZE, default=0): cv.int_range(min=0, max=64),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
         cv.GenerateID(CONF_RAW_GLYPH_ID): cv.declare_id(GlyphData),
     }
@@ -408,6 +412,10 @@ async def to_code(config):
 
     glyphs = cg.static_const_array(config[CONF_RAW_GLYPH_ID], glyph_initializer)
 
-    cg.new_Pvariable(
+    var = cg.new_Pvariable(
         config[CONF_ID], glyphs, len(glyph_initializer), ascent, ascent + descent
     )
+    if config[CONF_GLYPH_CACHE]:
+        cg.add(var.enable_glyph_cache())
+    if config[CONF_TEXT_CACHE_SIZE] > 0:
+        cg.add(var.set_text_cache_size(config[CONF_TEXT_CACHE_SIZE]))
@@ -1,5 +1,8 @@
 #include "font.h"
 
+#include <algorithm>
+#include <climits>
+
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/color.h"
@@ -10,25 +13,46 @@ namespace font {
 
 static const char *const TAG = "font";
 
+/// Decode the UTF-8 character at \p str into \p codepoint, returns its length in bytes or 0 if it is not valid.
+static int decode_utf8(const char *str, uint32_t *codepoint) {
+  const uint8_t *s = reinterpret_cast<const uint8_t *>(str);
+  int length;
+  uint32_t value;
+  if (s[0] < 0x80) {
+    *codepoint = s[0];
+    return 1;
+  } else if ((s[0] & 0xE0) == 0xC0) {
+    length = 2;
+    value = s[0] & 0x1F;
+  } else if ((s[0] & 0xF0) == 0xE0) {
+    length = 3;
+    value = s[0] & 0x0F;
+  } else if ((s[0] & 0xF8) == 0xF0) {
+    length = 4;
+    value = s[0] & 0x07;
+  } else {
+    return 0;
+  }
+  for (int i = 1; i < length; i++) {
+    // also stops at the terminating '\0'
+    if ((s[i] & 0xC0) != 0x80)
+      return 0;
+    value = (value << 6) | (s[i] & 0x3F);
+  }
+  *codepoint = value;
+  return length;
+}
+
 void Glyph::draw(int x_at, int y_start, display::Display *display, Color color) const {
   int scan_x1, scan_y1, scan_width, scan_height;
   this->scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
   const unsigned char *data = this->glyph_data_->data;
-  const int max_x = x_at + scan_x1 + scan_width;
+  const int row_bytes = (scan_width + 7) / 8;
   const int max_y = y_start + scan_y1 + scan_height;
 
-  for (int glyph_y = y_start + scan_y1; glyph_y < max_y; glyph_y++) {
-    for (int glyph_x = x_at + scan_x1; glyph_x < max_x; data++, glyph_x += 8) {
-      uint8_t pixel_data = progmem_read_byte(data);
-      const int pixel_max_x = std::min(max_x, glyph_x + 8);
-
-      for (int pixel_x = glyph_x; pixel_x < pixel_max_x && pixel_data; pixel_x++, pixel_data <<= 1) {
-        if (pixel_data & 0x80) {
-          display->draw_pixel_at(pixel_x, glyph_y, color);
-        }
-      }
-    }
+  for (int glyph_y = y_start + scan_y1; glyph_y < max_y; glyph_y++, data += row_bytes) {
+    display->blit_mono_row(x_at + scan_x1, glyph_y, data, scan_width, color, display::COLOR_OFF, true);
   }
 }
 const char *Glyph::get_char() const { return this->glyph_data_->a_char; }
@@ -70,7 +94,50 @@ Font::Font(const GlyphData *data, int data_nr, int baseline, int height) : basel
   for (int i = 0; i < data_nr; ++i)
     glyphs_.emplace_back(&data[i]);
 }
+void Font::enable_glyph_cache() {
+  std::vector<int16_t> ascii_glyphs(128, -1);
+  std::vector<std::pair<uint32_t, int16_t>> other_glyphs;
+  for (size_t i = 0; i < this->glyphs_.size(); i++) {
+    const char *a_char = this->glyphs_[i].get_char();
+    uint32_t codepoint;
+    int length = decode_utf8(a_char, &codepoint);
+    if (length == 0 || a_char[length] != '\0') {
+      ESP_LOGD(TAG, "Glyph '%s' is not a single character, not using the glyph cache", a_char);
+      return;
+    }
+    if (codepoint < ascii_glyphs.size()) {
+      ascii_glyphs[codepoint] = i;
+    } else {
+      other_glyphs.emplace_back(codepoint, i);
+    }
+  }
+  std::sort(other_glyphs.begin(), other_glyphs.end());
+  this->ascii_glyphs_ = std::move(ascii_glyphs);
+  this->other_glyphs_ = std::move(other_glyphs);
+}
+int Font::match_cached_glyph_(const char *str, int *match_length) {
+  *match_length = 0;
+  uint32_t codepoint;
+  int length = decode_utf8(str, &codepoint);
+  if (length == 0)
+    return -1;
+  int glyph_n = -1;
+  if (codepoint < this->ascii_glyphs_.size()) {
+    glyph_n = this->ascii_glyphs_[codepoint];
+  } else {
+    auto it = std::lower_bound(this->other_glyphs_.begin(), this->other_glyphs_.end(),
+                               std::make_pair(codepoint, int16_t(INT16_MIN)));
+    if (it != this->other_glyphs_.end() && it->first == codepoint)
+      glyph_n = it->second;
+  }
+  if (glyph_n >= 0)
+    *match_length = length;
+  return glyph_n;
+}
 int Font::match_next_glyph(const char *str, int *match_length) {
+  if (!this->ascii_glyphs_.empty())
+    return this->match_cached_glyph_(str, match_length);
+
   int lo = 0;
   int hi = this->glyphs_.size() - 1;
   while (lo != hi) {
@@ -89,6 +156,15 @@ int Font::match_next_glyph(const char *str, int *match_length) {
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
   *height = this->height_;
+  if (this->text_cache_size_ != 0) {
+    const TextRun &run = this->get_text_run_(str);
+    *width = run.width;
+    *x_offset = run.x_offset;
+    return;
+  }
+  this->measure_glyphs_(str, width, x_offset);
+}
+void Font::measure_glyphs_(const char *str, int *width, int *x_offset) {
   int i = 0;
   int min_x = 0;
   bool has_char = false;
@@ -119,6 +195,17 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *width = x - min_x;
 }
 void Font::print(int x_start, int y_start, display::Display *display, Color color, const char *text) {
+  if (this->text_cache_size_ != 0) {
+    const TextRun &run = this->get_text_run_(text);
+    const int row_bytes = (run.bitmap_width + 7) / 8;
+    const uint8_t *data = run.bitmap.data();
+    for (int row = 0; row < run.bitmap_height; row++, data += row_bytes) {
+      display->blit_mono_row(x_start + run.bitmap_x, y_start + run.bitmap_y + row, data, run.bitmap_width, color,
+                             display::COLOR_OFF, true);
+    }
+    return;
+  }
+
   int i = 0;
   int x_at = x_start;
   while (text[i] != '\0') {
@@ -144,6 +231,110 @@ void Font::print(int x_start, int y_start, display::Display *display, Color colo
     i += match_length;
   }
 }
+const Font::TextRun &Font::get_text_run_(const char *text) {
+  this->text_cache_clock_++;
+  TextRun *run = nullptr;
+  for (auto &cached : this->text_cache_) {
+    if (cached.text == text) {
+      cached.last_used = this->text_cache_clock_;
+      return cached;
+    }
+    if (run == nullptr || cached.last_used < run->last_used)
+      run = &cached;
+  }
+
+  // not cached yet, replace the least recently used run if the cache is full
+  if (this->text_cache_.size() < this->text_cache_size_) {
+    this->text_cache_.emplace_back();
+    run = &this->text_cache_.back();
+  }
+  run->text = text;
+  run->last_used = this->text_cache_clock_;
+  this->measure_glyphs_(text, &run->width, &run->x_offset);
+  this->rasterize_(*run);
+  return *run;
+}
+void Font::rasterize_(TextRun &run) {
+  // Place the glyphs like print() does, glyph -1 stands for the box drawn for unknown characters
+  struct Placement {
+    int x;
+    int glyph;
+  };
+  std::vector<Placement> placements;
+  int x_min = INT_MAX, y_min = INT_MAX, x_max = INT_MIN, y_max = INT_MIN;
+  auto extend = [&](int x, int y, int width, int height) {
+    if (width <= 0 || height <= 0)
+      return;
+    x_min = std::min(x_min, x);
+    y_min = std::min(y_min, y);
+    x_max = std::max(x_max, x + width);
+    y_max = std::max(y_max, y + height);
+  };
+
+  const char *text = run.text.c_str();
+  int i = 0;
+  int x_at = 0;
+  while (text[i] != '\0') {
+    int match_length;
+    int glyph_n = this->match_next_glyph(text + i, &match_length);
+    if (glyph_n < 0) {
+      // Unknown char, skip
+      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
+      if (!this->get_glyphs().empty()) {
+        uint8_t glyph_width = this->get_glyphs()[0].glyph_data_->width;
+        placements.push_back({x_at, -1});
+        extend(x_at, 0, glyph_width, this->height_);
+        x_at += glyph_width;
+      }
+
+      i++;
+      continue;
+    }
+
+    const GlyphData *data = this->glyphs_[glyph_n].glyph_data_;
+    placements.push_back({x_at, glyph_n});
+    extend(x_at + data->offset_x, data->offset_y, data->width, data->height);
+    x_at += data->width + data->offset_x;
+
+    i += match_length;
+  }
+
+  if (x_min >= x_max) {
+    run.bitmap_x = run.bitmap_y = run.bitmap_width = run.bitmap_height = 0;
+    run.bitmap.clear();
+    return;
+  }
+  run.bitmap_x = x_min;
+  run.bitmap_y = y_min;
+  run.bitmap_width = x_max - x_min;
+  run.bitmap_height = y_max - y_min;
+  const int row_bytes = (run.bitmap_width + 7) / 8;
+  run.bitmap.assign(row_bytes * run.bitmap_height, 0);
+  auto set_pixel = [&](int x, int y) {
+    x -= x_min;
+    y -= y_min;
+    run.bitmap[y * row_bytes + x / 8] |= 0x80 >> (x % 8);
+  };
+
+  for (const auto &placement : placements) {
+    if (placement.glyph < 0) {
+      uint8_t glyph_width = this->get_glyphs()[0].glyph_data_->width;
+      for (int y = 0; y < this->height_; y++) {
+        for (int x = placement.x; x < placement.x + glyph_width; x++)
+          set_pixel(x, y);
+      }
+      continue;
+    }
+    const GlyphData *data = this->glyphs_[placement.glyph].glyph_data_;
+    const int glyph_row_bytes = (data->width + 7) / 8;
+    for (int y = 0; y < data->height; y++) {
+      for (int x = 0; x < data->width; x++) {
+        if (progmem_read_byte(data->data + y * glyph_row_bytes + x / 8) & (0x80 >> (x % 8)))
+          set_pixel(placement.x + data->offset_x + x, data->offset_y + y);
+      }
+    }
+  }
+}
 
 }  // namespace font
 }  // namespace esphome
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "esphome/core/datatypes.h"
 #include "esphome/core/color.h"
 #include "esphome/components/display/display_buffer.h"
@@ -57,10 +61,42 @@ class Font : public display::BaseFont {
 
   const std::vector<Glyph, ExternalRAMAllocator<Glyph>> &get_glyphs() const { return glyphs_; }
 
+  /** Look up glyphs by codepoint in a flat table instead of binary searching the glyph strings.
+   *
+   * Only used when every glyph is a single UTF-8 character, fonts with multi-character glyphs keep the search.
+   */
+  void enable_glyph_cache();
+  /// Keep the measurements and the rendered bitmap of the last \p size strings, 0 disables the cache.
+  void set_text_cache_size(size_t size) { this->text_cache_size_ = size; }
+
  protected:
+  /// A measured and rasterized string, one bit per pixel like the glyph data.
+  struct TextRun {
+    std::string text;
+    uint32_t last_used;
+    int width;
+    int x_offset;
+    int bitmap_x;  ///< Left of the bitmap relative to the x passed to print()
+    int bitmap_y;  ///< Top of the bitmap relative to the y passed to print()
+    int bitmap_width;
+    int bitmap_height;
+    std::vector<uint8_t> bitmap;
+  };
+
+  int match_cached_glyph_(const char *str, int *match_length);
+  void measure_glyphs_(const char *str, int *width, int *x_offset);
+  const TextRun &get_text_run_(const char *text);
+  void rasterize_(TextRun &run);
+
   std::vector<Glyph, ExternalRAMAllocator<Glyph>> glyphs_;
   int baseline_;
   int height_;
+
+  std::vector<int16_t> ascii_glyphs_;                       ///< Glyph index per ASCII character, -1 if missing
+  std::vector<std::pair<uint32_t, int16_t>> other_glyphs_;  ///< Sorted (codepoint, glyph index) beyond ASCII
+  size_t text_cache_size_{0};
+  uint32_t text_cache_clock_{0};
+  std::vector<TextRun> text_cache_;
 };
 
 }  // namespace font
@@ -1,7 +1,17 @@
 #ifdef USE_HOST
 
 #include "preferences.h"
+#include <cerrno>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "esphome/core/application.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
@@ -12,16 +22,292 @@ namespace host {
 
 static const char *const TAG = "host.preferences";
 
+/// "EHPF" in little endian, followed by the format version.
+static const uint32_t PREFS_MAGIC = 0x46504845;
+static const uint32_t PREFS_VERSION = 1;
+/// Compact the log on sync() when it holds more than this many records per live key.
+static const size_t PREFS_COMPACT_RATIO = 4;
+/// Records claiming to be longer than this are treated as damaged.
+static const uint32_t PREFS_MAX_LENGTH = 65536;
+
+/** Preferences stored in an append-only log file.
+ *
+ * The file starts with PREFS_MAGIC and PREFS_VERSION, followed by records of the form
+ * `type (u32) | length (u32) | data | crc32 (u32)`, all little endian. The CRC covers type, length and data. The last
+ * record for a type wins. Loading stops at the first damaged record, which is where an interrupted write ended.
+ *
+ * Like on ESP32, save() only updates a pending copy in RAM, sync() appends the changed values to the log and
+ * rewrites the file without the superseded records once too many of them have accumulated.
+ *
+ * The file is `$ESPHOME_PREFS_FILE` if set, otherwise `~/.esphome/prefs/<name>.prefs`.
+ */
 class HostPreferences : public ESPPreferences {
  public:
-  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override { return {}; }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
+    return make_preference(length, type);
+  }
+  ESPPreferenceObject make_preference(size_t length, uint32_t type) override;
+
+  bool save(uint32_t type, const uint8_t *data, size_t len) {
+    if (this->reset_)
+      return false;
+    this->pending_save_[type].assign(data, data + len);
+    ESP_LOGVV(TAG, "pending_save: type: %" PRIu32 ", len: %zu", type, len);
+    return true;
+  }
+
+  bool load(uint32_t type, uint8_t *data, size_t len) {
+    auto it = this->pending_save_.find(type);
+    if (it == this->pending_save_.end()) {
+      it = this->stored_.find(type);
+      if (it == this->stored_.end())
+        return false;
+    }
+    if (it->second.size() != len) {
+      ESP_LOGVV(TAG, "Length does not match (%zu!=%zu)", it->second.size(), len);
+      return false;
+    }
+    memcpy(data, it->second.data(), len);
+    return true;
+  }
+
+  bool sync() override;
+  bool reset() override;
+
+ protected:
+  void open_();
+  bool read_log_();
+  bool compact_();
+  bool write_record_(FILE *file, uint32_t type, const std::vector<uint8_t> &data);
+  bool flush_(FILE *file);
+
+  std::string filename_;
+  bool opened_{false};
+  bool reset_{false};
+  /// Values as stored in the file.
+  std::map<uint32_t, std::vector<uint8_t>> stored_;
+  /// Values saved since the last sync().
+  std::map<uint32_t, std::vector<uint8_t>> pending_save_;
+  /// Number of records in the file, including superseded ones.
+  size_t records_{0};
+};
+
+class HostPreferenceBackend : public ESPPreferenceBackend {
+ public:
+  HostPreferenceBackend(HostPreferences *prefs, uint32_t type) : prefs_(prefs), type_(type) {}
 
-  ESPPreferenceObject make_preference(size_t length, uint32_t type) override { return {}; }
+  bool save(const uint8_t *data, size_t len) override { return this->prefs_->save(this->type_, data, len); }
+  bool load(uint8_t *data, size_t len) override { return this->prefs_->load(this->type_, data, len); }
 
-  bool sync() override { return true; }
-  bool reset() override { return true; }
+ protected:
+  HostPreferences *prefs_;
+  uint32_t type_;
 };
 
+ESPPreferenceObject HostPreferences::make_preference(size_t length, uint32_t type) {
+  // The application name is only known once setup() has started, so the file is opened lazily.
+  this->open_();
+  auto *pref = new HostPreferenceBackend(this, type);  // NOLINT(cppcoreguidelines-owning-memory)
+  return ESPPreferenceObject(pref);
+}
+
+void HostPreferences::open_() {
+  if (this->opened_)
+    return;
+  this->opened_ = true;
+
+  const char *env = getenv("ESPHOME_PREFS_FILE");
+  if (env != nullptr && *env != '\0') {
+    this->filename_ = env;
+  } else {
+    const char *home = getenv("HOME");
+    std::string dir = home != nullptr ? home : ".";
+    dir += "/.esphome";
+    mkdir(dir.c_str(), 0755);
+    dir += "/prefs";
+    mkdir(dir.c_str(), 0755);
+    this->filename_ = dir + "/" + App.get_name() + ".prefs";
+  }
+
+  if (!this->read_log_()) {
+    // Start over with an empty file, keeping whatever could be read.
+    this->compact_();
+  }
+  ESP_LOGD(TAG, "Loaded %zu preferences (%zu records) from %s", this->stored_.size(), this->records_,
+           this->filename_.c_str());
+}
+
+static bool read_u32(FILE *file, uint32_t *value) {
+  uint8_t buf[4];
+  if (fread(buf, 1, sizeof(buf), file) != sizeof(buf))
+    return false;
+  *value = encode_uint32(buf[3], buf[2], buf[1], buf[0]);
+  return true;
+}
+
+static void put_u32(uint8_t *buf, uint32_t value) {
+  buf[0] = value;
+  buf[1] = value >> 8;
+  buf[2] = value >> 16;
+  buf[3] = value >> 24;
+}
+
+bool HostPreferences::read_log_() {
+  FILE *file = fopen(this->filename_.c_str(), "rb");
+  if (file == nullptr) {
+    if (errno != ENOENT)
+      ESP_LOGW(TAG, "Could not open %s: %s", this->filename_.c_str(), strerror(errno));
+    return false;
+  }
+
+  uint32_t magic, version;
+  if (!read_u32(file, &magic) || !read_u32(file, &version) || magic != PREFS_MAGIC || version != PREFS_VERSION) {
+    ESP_LOGW(TAG, "%s is not a preferences file, starting over", this->filename_.c_str());
+    fclose(file);
+    return false;
+  }
+
+  bool clean = true;
+  std::vector<uint8_t> data;
+  while (true) {
+    uint8_t header[8];
+    size_t read = fread(header, 1, sizeof(header), file);
+    if (read == 0)
+      break;
+    if (read != sizeof(header)) {
+      clean = false;
+      break;
+    }
+    uint32_t type = encode_uint32(header[3], header[2], header[1], header[0]);
+    uint32_t len = encode_uint32(header[7], header[6], header[5], header[4]);
+    if (len > PREFS_MAX_LENGTH) {
+      clean = false;
+      break;
+    }
+    uint32_t crc;
+    data.resize(len);
+    if (fread(data.data(), 1, len, file) != len || !read_u32(file, &crc) ||
+        crc != crc32(data.data(), len, crc32(header, sizeof(header)))) {
+      clean = false;
+      break;
+    }
+    this->stored_[type] = data;
+    this->records_++;
+  }
+  fclose(file);
+
+  if (!clean)
+    ESP_LOGW(TAG, "Ignoring damaged record at the end of %s", this->filename_.c_str());
+  return clean;
+}
+
+bool HostPreferences::write_record_(FILE *file, uint32_t type, const std::vector<uint8_t> &data) {
+  uint8_t header[8];
+  put_u32(header, type);
+  put_u32(header + 4, data.size());
+  uint8_t crc[4];
+  put_u32(crc, crc32(data.data(), data.size(), crc32(header, sizeof(header))));
+  return fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+         fwrite(data.data(), 1, data.size(), file) == data.size() && fwrite(crc, 1, sizeof(crc), file) == sizeof(crc);
+}
+
+bool HostPreferences::flush_(FILE *file) { return fflush(file) == 0 && fsync(fileno(file)) == 0; }
+
+bool HostPreferences::compact_() {
+  // Write the live values to a new file and atomically replace the log with it.
+  std::string tmp = this->filename_ + ".tmp";
+  FILE *file = fopen(tmp.c_str(), "wb");
+  if (file == nullptr) {
+    ESP_LOGE(TAG, "Could not create %s: %s", tmp.c_str(), strerror(errno));
+    return false;
+  }
+  uint8_t header[8];
+  put_u32(header, PREFS_MAGIC);
+  put_u32(header + 4, PREFS_VERSION);
+  bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header);
+  for (const auto &it : this->stored_)
+    ok = ok && this->write_record_(file, it.first, it.second);
+  ok = this->flush_(file) && ok;
+  fclose(file);
+  if (!ok || rename(tmp.c_str(), this->filename_.c_str()) != 0) {
+    ESP_LOGE(TAG, "Could not write %s: %s", this->filename_.c_str(), strerror(errno));
+    unlink(tmp.c_str());
+    return false;
+  }
+  this->records_ = this->stored_.size();
+  return true;
+}
+
+bool HostPreferences::sync() {
+  if (this->pending_save_.empty() || this->reset_)
+    return true;
+  this->open_();
+
+  ESP_LOGD(TAG, "Saving %zu preferences to %s...", this->pending_save_.size(), this->filename_.c_str());
+  int cached = 0, written = 0;
+  FILE *file = nullptr;
+  bool ok = true;
+  for (auto &it : this->pending_save_) {
+    auto stored = this->stored_.find(it.first);
+    if (stored != this->stored_.end() && stored->second == it.second) {
+      cached++;
+      continue;
+    }
+    if (file == nullptr) {
+      file = fopen(this->filename_.c_str(), "ab");
+      if (file == nullptr) {
+        ESP_LOGE(TAG, "Could not open %s: %s", this->filename_.c_str(), strerror(errno));
+        return false;
+      }
+    }
+    if (!this->write_record_(file, it.first, it.second)) {
+      ok = false;
+      break;
+    }
+    this->stored_[it.first] = it.second;
+    this->records_++;
+    written++;
+  }
+  if (file != nullptr) {
+    ok = this->flush_(file) && ok;
+    fclose(file);
+  }
+  if (!ok) {
+    // The file ends with a partial record now, rewrite it from the values that made it.
+    ESP_LOGE(TAG, "Error writing %s: %s", this->filename_.c_str(), strerror(errno));
+    for (auto it = this->pending_save_.begin(); it != this->pending_save_.end();) {
+      auto stored = this->stored_.find(it->first);
+      if (stored != this->stored_.end() && stored->second == it->second) {
+        it = this->pending_save_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    this->compact_();
+    return false;
+  }
+  this->pending_save_.clear();
+  ESP_LOGD(TAG, "Saving %d preferences: %d cached, %d written", cached + written, cached, written);
+
+  if (this->records_ > this->stored_.size() * PREFS_COMPACT_RATIO) {
+    ESP_LOGD(TAG, "Compacting %zu records to %zu", this->records_, this->stored_.size());
+    return this->compact_();
+  }
+  return true;
+}
+
+bool HostPreferences::reset() {
+  ESP_LOGD(TAG, "Cleaning up preferences...");
+  this->pending_save_.clear();
+  this->stored_.clear();
+  this->records_ = 0;
+  if (!this->filename_.empty())
+    unlink(this->filename_.c_str());
+  // Prevent any saves until restart
+  this->reset_ = true;
+  return true;
+}
+
 void setup_preferences() {
   auto *pref = new HostPreferences();  // NOLINT(cppcoreguidelines-owning-memory)
   global_preferences = pref;
@@ -13,10 +13,6 @@ void ILI9XXXDisplay::setup() {
   this->setup_pins_();
   this->initialize();
 
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
   if (this->buffer_color_mode_ == BITS_16) {
     this->init_internal_(this->get_buffer_length_() * 2);
     if (this->buffer_ != nullptr) {
@@ -74,10 +70,7 @@ float ILI9XXXDisplay::get_setup_priority() const { return setup_priority::HARDWA
 
 void ILI9XXXDisplay::fill(Color color) {
   uint16_t new_color = 0;
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
+  this->mark_dirty_all_();
   switch (this->buffer_color_mode_) {
     case BITS_8_INDEXED:
       new_color = display::ColorUtil::color_to_index8_palette888(color, this->palette_);
@@ -137,16 +130,27 @@ void HOT ILI9XXXDisplay::draw_absolute_pixel_internal(int x, int y, Color color)
     updated = true;
   }
   if (updated) {
-    // low and high watermark may speed up drawing from buffer
-    this->x_low_ = (x < this->x_low_) ? x : this->x_low_;
-    this->y_low_ = (y < this->y_low_) ? y : this->y_low_;
-    this->x_high_ = (x > this->x_high_) ? x : this->x_high_;
-    this->y_high_ = (y > this->y_high_) ? y : this->y_high_;
-    // ESP_LOGVV(TAG, "=>>> pixel (x:%d, y:%d) (xl:%d, xh:%d, yl:%d, yh:%d", x, y, this->x_low_, this->x_high_,
-    //           this->y_low_, this->y_high_);
+    // only the changed regions are sent to the display
+    this->mark_dirty_(x, y);
   }
 }
 
+void HOT ILI9XXXDisplay::fill_span_internal_(int x, int y, int width, Color color) {
+  if (this->buffer_color_mode_ != BITS_16) {
+    display::DisplayBuffer::fill_span_internal_(x, y, width, color);
+    return;
+  }
+  this->fill_span_rgb565_(x, y, width, display::ColorUtil::color_to_565(color, display::ColorOrder::COLOR_ORDER_RGB));
+}
+
+void HOT ILI9XXXDisplay::blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  if (this->buffer_color_mode_ != BITS_16) {
+    display::DisplayBuffer::blit_rgb565_span_internal_(x, y, data, width, transparent);
+    return;
+  }
+  this->blit_rgb565_span_rgb565_(x, y, data, width, transparent);
+}
+
 void ILI9XXXDisplay::update() {
   if (this->prossing_update_) {
     this->need_update_ = true;
@@ -162,23 +166,26 @@ void ILI9XXXDisplay::update() {
 }
 
 void ILI9XXXDisplay::display_() {
-  // we will only update the changed window to the display
-  uint16_t w = this->x_high_ - this->x_low_ + 1;  // NOLINT
-  uint16_t h = this->y_high_ - this->y_low_ + 1;  // NOLINT
-  uint32_t start_pos = ((this->y_low_ * this->width_) + x_low_);
-
-  // check if something was displayed
-  if ((this->x_high_ < this->x_low_) || (this->y_high_ < this->y_low_)) {
+  // we will only update the changed windows to the display
+  if (this->dirty_count_ == 0) {
     ESP_LOGV(TAG, "Nothing to display");
     return;
   }
 
-  set_addr_window_(this->x_low_, this->y_low_, w, h);
+  this->coalesce_dirty_();
+  for (uint8_t i = 0; i < this->dirty_count_; i++)
+    this->display_window_(this->dirty_rects_[i]);
+  this->clear_dirty_();
+}
+
+void ILI9XXXDisplay::display_window_(const display::Rect &rect) {
+  uint16_t w = rect.w;  // NOLINT
+  uint16_t h = rect.h;  // NOLINT
+  uint32_t start_pos = ((rect.y * this->width_) + rect.x);
+
+  set_addr_window_(rect.x, rect.y, w, h);
 
-  ESP_LOGV(TAG,
-           "Start display(xlow:%d, ylow:%d, xhigh:%d, yhigh:%d, width:%d, "
-           "heigth:%d, start_pos:%d)",
-           this->x_low_, this->y_low_, this->x_high_, this->y_high_, w, h, start_pos);
+  ESP_LOGV(TAG, "Start display(x:%d, y:%d, width:%d, heigth:%d, start_pos:%d)", rect.x, rect.y, w, h, start_pos);
 
   this->start_data_();
   for (uint16_t row = 0; row < h; row++) {
@@ -214,12 +221,6 @@ void ILI9XXXDisplay::display_() {
     App.feed_wdt();
   }
   this->end_data_();
-
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 uint32_t ILI9XXXDisplay::buffer_to_transfer_(uint32_t pos, uint32_t sz) {
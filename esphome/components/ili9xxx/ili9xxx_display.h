@@ -49,10 +49,13 @@ class ILI9XXXDisplay : public PollingComponent,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_span_internal_(int x, int y, int width, Color color) override;
+  void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) override;
   void setup_pins_();
   virtual void initialize() = 0;
 
   void display_();
+  void display_window_(const display::Rect &rect);
   void init_lcd_(const uint8_t *init_cmd);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void invert_display_(bool invert);
@@ -60,10 +63,6 @@ class ILI9XXXDisplay : public PollingComponent,
 
   int16_t width_{0};   ///< Display width as modified by current rotation
   int16_t height_{0};  ///< Display height as modified by current rotation
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
   const uint8_t *palette_;
 
   ILI9XXXColorMode buffer_color_mode_{BITS_16};
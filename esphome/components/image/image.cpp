@@ -8,14 +8,10 @@ namespace image {
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          if (this->get_binary_pixel_(img_x, img_y)) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_on);
-          } else if (!this->transparent_) {
-            display->draw_pixel_at(x + img_x, y + img_y, color_off);
-          }
-        }
+      const int row_bytes = (this->width_ + 7) / 8;
+      for (int img_y = 0; img_y < height_; img_y++) {
+        display->blit_mono_row(x, y + img_y, this->data_start_ + img_y * row_bytes, this->width_, color_on, color_off,
+                               this->transparent_);
       }
       break;
     }
@@ -30,14 +26,7 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
-          auto color = this->get_rgb565_pixel_(img_x, img_y);
-          if (color.w >= 0x80) {
-            display->draw_pixel_at(x + img_x, y + img_y, color);
-          }
-        }
-      }
+      display->blit_rgb565_rows(x, y, this->data_start_, this->width_, this->height_, this->transparent_);
       break;
     case IMAGE_TYPE_RGB24:
       for (int img_x = 0; img_x < width_; img_x++) {
@@ -106,10 +95,7 @@ Color Image::get_rgb565_pixel_(int x, int y) const {
   const uint32_t pos = (x + y * this->width_) * 2;
   uint16_t rgb565 =
       progmem_read_byte(this->data_start_ + pos + 0) << 8 | progmem_read_byte(this->data_start_ + pos + 1);
-  auto r = (rgb565 & 0xF800) >> 11;
-  auto g = (rgb565 & 0x07E0) >> 5;
-  auto b = rgb565 & 0x001F;
-  Color color = Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+  Color color = display::ColorUtil::rgb565_to_color(rgb565);
   if (rgb565 == 0x0020 && transparent_) {
     // darkest green has been defined as transparent color for transparent RGB565 images.
     color.w = 0;
@@ -1,6 +1,10 @@
 #include "json_util.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
 #ifdef USE_ESP8266
 #include <Esp.h>
 #endif
@@ -62,6 +66,184 @@ std::string build_json(const json_build_t &f) {
   }
 }
 
+void write_json(std::string &out, const json_write_t &f) {
+  JsonWriter root(out);
+  f(root);
+  root.finish();
+}
+
+JsonWriter::JsonWriter(std::string &out) : out_(out) {
+  this->out_.clear();
+  this->open_('{');
+}
+
+const char *JsonWriter::finish() {
+  this->overflow_ = 0;
+  while (this->depth_ > 0)
+    this->close_((this->arrays_ & (1u << (this->depth_ - 1))) ? ']' : '}');
+  return this->out_.c_str();
+}
+
+void JsonWriter::begin_object(const char *key) {
+  this->write_key_(key);
+  this->open_('{');
+}
+void JsonWriter::begin_object() {
+  this->write_separator_();
+  this->open_('{');
+}
+void JsonWriter::end_object() { this->close_('}'); }
+void JsonWriter::begin_array(const char *key) {
+  this->write_key_(key);
+  this->open_('[');
+}
+void JsonWriter::begin_array() {
+  this->write_separator_();
+  this->open_('[');
+}
+void JsonWriter::end_array() { this->close_(']'); }
+
+void JsonWriter::add(const char *key, const char *value) {
+  this->write_key_(key);
+  this->write_string_(value);
+}
+void JsonWriter::add(const char *key, bool value) {
+  this->write_key_(key);
+  this->write_integer_(value);
+}
+void JsonWriter::add(const char *key, float value) {
+  this->write_key_(key);
+  this->write_double_(value, 7);
+}
+void JsonWriter::add(const char *key, double value) {
+  this->write_key_(key);
+  this->write_double_(value, 15);
+}
+void JsonWriter::add_null(const char *key) {
+  this->write_key_(key);
+  this->out_.append("null");
+}
+void JsonWriter::add(const char *value) {
+  this->write_separator_();
+  this->write_string_(value);
+}
+
+void JsonWriter::open_(char c) {
+  if (this->depth_ >= 32) {
+    // write a value in place of the container, so its key stays valid, and drop the matching close_() as well
+    ESP_LOGE(TAG, "JSON nesting too deep");
+    this->out_.append("null");
+    this->overflow_++;
+    return;
+  }
+  this->out_.push_back(c);
+  const uint32_t bit = 1u << this->depth_;
+  this->empty_ |= bit;
+  if (c == '[') {
+    this->arrays_ |= bit;
+  } else {
+    this->arrays_ &= ~bit;
+  }
+  this->depth_++;
+}
+
+void JsonWriter::close_(char c) {
+  if (this->overflow_ > 0) {
+    this->overflow_--;
+    return;
+  }
+  if (this->depth_ == 0)
+    return;
+  this->depth_--;
+  this->out_.push_back(c);
+}
+
+void JsonWriter::write_separator_() {
+  if (this->depth_ == 0)
+    return;
+  const uint32_t bit = 1u << (this->depth_ - 1);
+  if (this->empty_ & bit) {
+    this->empty_ &= ~bit;
+  } else {
+    this->out_.push_back(',');
+  }
+}
+
+void JsonWriter::write_key_(const char *key) {
+  this->write_separator_();
+  this->write_string_(key);
+  this->out_.push_back(':');
+}
+
+void JsonWriter::write_string_(const char *value) {
+  if (value == nullptr) {
+    this->out_.append("null");
+    return;
+  }
+  this->out_.push_back('"');
+  const char *run = value;
+  for (const char *p = value; *p != '\0'; p++) {
+    const auto c = static_cast<uint8_t>(*p);
+    if (c >= 0x20 && c != '"' && c != '\\')
+      continue;
+    // flush the unescaped run before this character in one append
+    this->out_.append(run, p - run);
+    run = p + 1;
+    this->out_.push_back('\\');
+    switch (c) {
+      case '"':
+      case '\\':
+        this->out_.push_back(static_cast<char>(c));
+        break;
+      case '\b':
+        this->out_.push_back('b');
+        break;
+      case '\f':
+        this->out_.push_back('f');
+        break;
+      case '\n':
+        this->out_.push_back('n');
+        break;
+      case '\r':
+        this->out_.push_back('r');
+        break;
+      case '\t':
+        this->out_.push_back('t');
+        break;
+      default: {
+        char buf[6];
+        snprintf(buf, sizeof(buf), "u%04x", c);
+        this->out_.append(buf, 5);
+        break;
+      }
+    }
+  }
+  this->out_.append(run);
+  this->out_.push_back('"');
+}
+
+void JsonWriter::write_double_(double value, int precision) {
+  // Like ArduinoJson, NaN and infinity are not valid JSON numbers and are written as null
+  if (!std::isfinite(value)) {
+    this->out_.append("null");
+    return;
+  }
+  char buf[24];
+  int len = snprintf(buf, sizeof(buf), "%.*g", precision, value);
+  if (len > 0)
+    this->out_.append(buf, std::min<size_t>(len, sizeof(buf) - 1));
+}
+
+void JsonWriter::write_unsigned_(uint64_t value) {
+  char buf[20];
+  char *p = buf + sizeof(buf);
+  do {
+    *--p = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value != 0);
+  this->out_.append(p, buf + sizeof(buf) - p);
+}
+
 void parse_json(const std::string &data, const json_parse_t &f) {
   // Here we are allocating 1.5 times the data size,
   // with the heap size minus 2kb to be safe if less than that
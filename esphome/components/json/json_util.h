@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+#include <type_traits>
 #include <vector>
 
 #include "esphome/core/helpers.h"
@@ -13,15 +15,130 @@
 namespace esphome {
 namespace json {
 
+class JsonWriter;
+
 /// Callback function typedef for parsing JsonObjects.
 using json_parse_t = std::function<void(JsonObject)>;
 
 /// Callback function typedef for building JsonObjects.
 using json_build_t = std::function<void(JsonObject)>;
 
+/// Callback function typedef for streaming JSON with a JsonWriter.
+using json_write_t = std::function<void(JsonWriter &)>;
+
 /// Build a JSON string with the provided json build function.
 std::string build_json(const json_build_t &f);
 
+/// Serialize a JSON object with the provided json write function into \p out, replacing its contents.
+void write_json(std::string &out, const json_write_t &f);
+
+/** Streaming JSON serializer writing directly into an output string.
+ *
+ * Unlike build_json() no document is allocated: members are appended to \p out as they are written, so the only
+ * allocation is growing the output string itself. Passing a buffer that is reused between calls keeps its capacity
+ * and makes steady-state serialization allocation free.
+ *
+ * Members can be written in the same `root["key"] = value;` style as a JsonObject. Because the output is streamed,
+ * every key must be written only once and nested objects and arrays must be completed before writing to their parent:
+ *
+ * ```cpp
+ * std::string buffer;
+ * json::JsonWriter root(buffer);
+ * root["state"] = "ON";
+ * root.begin_object("color");
+ * root["r"] = 255;
+ * root.end_object();
+ * root.begin_array("effects");
+ * root.add("None");
+ * root.end_array();
+ * publish(root.finish());
+ * ```
+ */
+class JsonWriter {
+ public:
+  /// Proxy returned by operator[], writes the member when assigned to.
+  class Member {
+   public:
+    Member(JsonWriter &writer, const char *key) : writer_(writer), key_(key) {}
+    template<typename T> void operator=(const T &value) { this->writer_.add(this->key_, value); }  // NOLINT
+
+   protected:
+    JsonWriter &writer_;
+    const char *key_;
+  };
+
+  /// Start a new JSON document in \p out (clearing it) and open its root object.
+  explicit JsonWriter(std::string &out);
+
+  Member operator[](const char *key) { return Member(*this, key); }
+
+  /// Close all open objects and arrays and return the serialized document.
+  const char *finish();
+
+  void begin_object(const char *key);
+  /// Open an object as the next element of the current array.
+  void begin_object();
+  void end_object();
+  void begin_array(const char *key);
+  /// Open an array as the next element of the current array.
+  void begin_array();
+  void end_array();
+
+  // Object members
+  void add(const char *key, const char *value);
+  void add(const char *key, const std::string &value) { this->add(key, value.c_str()); }
+  void add(const char *key, bool value);
+  /// Floats are written with the 7 significant digits they can hold, so 0.1f serializes as 0.1.
+  void add(const char *key, float value);
+  void add(const char *key, double value);
+  template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+  void add(const char *key, T value) {
+    this->write_key_(key);
+    this->write_integer_(value);
+  }
+  /// Enums are written as their numeric value.
+  template<typename T, typename std::enable_if<std::is_enum<T>::value, int>::type = 0>
+  void add(const char *key, T value) {
+    this->add(key, static_cast<typename std::underlying_type<T>::type>(value));
+  }
+  void add_null(const char *key);
+
+  // Array elements
+  void add(const char *value);
+  void add(const std::string &value) { this->add(value.c_str()); }
+  template<typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0> void add(T value) {
+    this->write_separator_();
+    this->write_integer_(value);
+  }
+
+ protected:
+  void write_separator_();
+  void write_key_(const char *key);
+  void write_string_(const char *value);
+  void write_double_(double value, int precision);
+  void write_integer_(bool value) { this->out_.append(value ? "true" : "false"); }
+  template<typename T> void write_integer_(T value) {
+    if (std::is_signed<T>::value && value < 0) {
+      this->out_.push_back('-');
+      this->write_unsigned_(~static_cast<uint64_t>(value) + 1);
+    } else {
+      this->write_unsigned_(static_cast<uint64_t>(value));
+    }
+  }
+  void write_unsigned_(uint64_t value);
+  void open_(char c);
+  void close_(char c);
+
+  std::string &out_;
+  /// Bit n is set while the container at depth n has no elements yet.
+  uint32_t empty_{0};
+  /// Bit n is set if the container at depth n is an array.
+  uint32_t arrays_{0};
+  uint8_t depth_{0};
+  /// Containers opened beyond the maximum depth of 32, which were not written and whose close is skipped.
+  uint16_t overflow_{0};
+};
+
 /// Parse a JSON string and run the provided json parse function if it's valid.
 void parse_json(const std::string &data, const json_parse_t &f);
 
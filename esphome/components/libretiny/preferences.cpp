@@ -1,6 +1,7 @@
 #ifdef USE_LIBRETINY
 
 #include "esphome/core/preferences.h"
+#include "esphome/core/preference_cache.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 #include <flashdb.h>
@@ -13,48 +14,36 @@ namespace libretiny {
 
 static const char *const TAG = "lt.preferences";
 
-struct NVSData {
-  std::string key;
-  std::vector<uint8_t> data;
-};
+static PreferenceCache s_pending_save;        // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static PreferenceWriteBudget s_write_budget;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
-static std::vector<NVSData> s_pending_save;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static std::string fdb_key(uint32_t type) { return str_sprintf("%u", type); }
 
 class LibreTinyPreferenceBackend : public ESPPreferenceBackend {
  public:
-  std::string key;
+  uint32_t type;
   fdb_kvdb_t db;
   fdb_blob_t blob;
 
   bool save(const uint8_t *data, size_t len) override {
-    // try find in pending saves and update that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        obj.data.assign(data, data + len);
-        return true;
-      }
-    }
-    NVSData save{};
-    save.key = key;
-    save.data.assign(data, data + len);
-    s_pending_save.emplace_back(save);
-    ESP_LOGVV(TAG, "s_pending_save: key: %s, len: %d", key.c_str(), len);
+    s_pending_save.save(type, data, len);
+    ESP_LOGVV(TAG, "s_pending_save: type: %u, len: %d", type, len);
     return true;
   }
 
   bool load(uint8_t *data, size_t len) override {
     // try find in pending saves and load from that
-    for (auto &obj : s_pending_save) {
-      if (obj.key == key) {
-        if (obj.data.size() != len) {
-          // size mismatch
-          return false;
-        }
-        memcpy(data, obj.data.data(), len);
-        return true;
+    const std::vector<uint8_t> *pending = s_pending_save.get_pending(type);
+    if (pending != nullptr) {
+      if (pending->size() != len) {
+        // size mismatch
+        return false;
       }
+      memcpy(data, pending->data(), len);
+      return true;
     }
 
+    std::string key = fdb_key(type);
     fdb_blob_make(blob, data, len);
     size_t actual_len = fdb_kv_get_blob(db, key.c_str(), blob);
     if (actual_len != len) {
@@ -63,6 +52,8 @@ class LibreTinyPreferenceBackend : public ESPPreferenceBackend {
     } else {
       ESP_LOGVV(TAG, "fdb_kv_get_blob: key: %s, len: %d", key.c_str(), len);
     }
+    // remember what is in flash, so sync() can skip unchanged values without reading them back
+    s_pending_save.set_stored(type, data, len);
     return true;
   }
 };
@@ -90,71 +81,82 @@ class LibreTinyPreferences : public ESPPreferences {
     auto *pref = new LibreTinyPreferenceBackend();  // NOLINT(cppcoreguidelines-owning-memory)
     pref->db = &db;
     pref->blob = &blob;
-
-    uint32_t keyval = type;
-    pref->key = str_sprintf("%u", keyval);
+    pref->type = type;
 
     return ESPPreferenceObject(pref);
   }
 
-  bool sync() override {
+  bool sync() override { return this->sync_(false); }
+  bool sync_within_budget() override { return this->sync_(true); }
+  void set_write_budget(uint32_t max_writes, uint32_t window_ms) override { s_write_budget.set(max_writes, window_ms); }
+
+  bool sync_(bool use_budget) {
     if (s_pending_save.empty())
       return true;
 
-    ESP_LOGD(TAG, "Saving %d preferences to flash...", s_pending_save.size());
+    ESP_LOGD(TAG, "Saving %d preferences to flash...", s_pending_save.pending_count());
     // goal try write all pending saves even if one fails
-    int cached = 0, written = 0, failed = 0;
+    int cached = 0, written = 0, failed = 0, deferred = 0;
     fdb_err_t last_err = FDB_NO_ERR;
     std::string last_key{};
 
-    // go through vector from back to front (makes erase easier/more efficient)
-    for (ssize_t i = s_pending_save.size() - 1; i >= 0; i--) {
-      const auto &save = s_pending_save[i];
-      ESP_LOGVV(TAG, "Checking if FDB data %s has changed", save.key.c_str());
-      if (is_changed(&db, save)) {
-        ESP_LOGV(TAG, "sync: key: %s, len: %d", save.key.c_str(), save.data.size());
-        fdb_blob_make(&blob, save.data.data(), save.data.size());
-        fdb_err_t err = fdb_kv_set_blob(&db, save.key.c_str(), &blob);
-        if (err != FDB_NO_ERR) {
-          ESP_LOGV(TAG, "fdb_kv_set_blob('%s', len=%u) failed: %d", save.key.c_str(), save.data.size(), err);
-          failed++;
-          last_err = err;
-          last_key = save.key;
-          continue;
-        }
-        written++;
-      } else {
-        ESP_LOGD(TAG, "FDB data not changed; skipping %s  len=%u", save.key.c_str(), save.data.size());
+    for (auto *save : s_pending_save.get_pending_entries()) {
+      std::string key = fdb_key(save->type);
+      ESP_LOGVV(TAG, "Checking if FDB data %s has changed", key.c_str());
+      bool changed = save->stored_crc_valid ? !s_pending_save.is_unchanged(*save) : is_changed(&db, key, save->data);
+      if (!changed) {
+        ESP_LOGD(TAG, "FDB data not changed; skipping %s  len=%u", key.c_str(), save->data.size());
+        s_pending_save.mark_synced(*save);
         cached++;
+        continue;
+      }
+      if (use_budget && !s_write_budget.consume()) {
+        deferred++;
+        continue;
       }
-      s_pending_save.erase(s_pending_save.begin() + i);
+      ESP_LOGV(TAG, "sync: key: %s, len: %d", key.c_str(), save->data.size());
+      fdb_blob_make(&blob, save->data.data(), save->data.size());
+      fdb_err_t err = fdb_kv_set_blob(&db, key.c_str(), &blob);
+      if (err != FDB_NO_ERR) {
+        ESP_LOGV(TAG, "fdb_kv_set_blob('%s', len=%u) failed: %d", key.c_str(), save->data.size(), err);
+        failed++;
+        last_err = err;
+        last_key = key;
+        continue;
+      }
+      s_pending_save.mark_synced(*save);
+      written++;
     }
-    ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed", cached + written + failed, cached,
-             written, failed);
+    ESP_LOGD(TAG, "Saving %d preferences to flash: %d cached, %d written, %d failed, %d deferred",
+             cached + written + failed + deferred, cached, written, failed, deferred);
     if (failed > 0) {
       ESP_LOGE(TAG, "Error saving %d preferences to flash. Last error=%d for key=%s", failed, last_err,
                last_key.c_str());
     }
+    if (deferred > 0) {
+      ESP_LOGW(TAG, "Flash write budget exhausted, deferring %d preferences", deferred);
+    }
 
     return failed == 0;
   }
 
-  bool is_changed(const fdb_kvdb_t db, const NVSData &to_save) {
-    NVSData stored_data{};
+  /// Fallback for values of which the CRC in flash is unknown (never loaded or written since boot).
+  bool is_changed(const fdb_kvdb_t db, const std::string &key, const std::vector<uint8_t> &to_save) {
+    std::vector<uint8_t> stored_data;
     struct fdb_kv kv;
-    fdb_kv_t kvp = fdb_kv_get_obj(db, to_save.key.c_str(), &kv);
+    fdb_kv_t kvp = fdb_kv_get_obj(db, key.c_str(), &kv);
     if (kvp == nullptr) {
-      ESP_LOGV(TAG, "fdb_kv_get_obj('%s'): nullptr - the key might not be set yet", to_save.key.c_str());
+      ESP_LOGV(TAG, "fdb_kv_get_obj('%s'): nullptr - the key might not be set yet", key.c_str());
       return true;
     }
-    stored_data.data.reserve(kv.value_len);
-    fdb_blob_make(&blob, stored_data.data.data(), kv.value_len);
-    size_t actual_len = fdb_kv_get_blob(db, to_save.key.c_str(), &blob);
+    stored_data.resize(kv.value_len);
+    fdb_blob_make(&blob, stored_data.data(), kv.value_len);
+    size_t actual_len = fdb_kv_get_blob(db, key.c_str(), &blob);
     if (actual_len != kv.value_len) {
-      ESP_LOGV(TAG, "fdb_kv_get_blob('%s') len mismatch: %u != %u", to_save.key.c_str(), actual_len, kv.value_len);
+      ESP_LOGV(TAG, "fdb_kv_get_blob('%s') len mismatch: %u != %u", key.c_str(), actual_len, kv.value_len);
       return true;
     }
-    return to_save.data != stored_data.data;
+    return to_save != stored_data;
   }
 
   bool reset() override {
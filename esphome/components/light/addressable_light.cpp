@@ -1,6 +1,8 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace light {
 
@@ -27,6 +29,54 @@ std::unique_ptr<LightTransformer> AddressableLight::create_default_transition()
   return make_unique<AddressableLightTransformer>(*this);
 }
 
+void AddressableLight::write_rgb(int32_t offset, const uint8_t *data, int32_t count, bool white_from_rgb) {
+  this->write_raw_<3>(offset, data, count, white_from_rgb);
+}
+
+void AddressableLight::write_rgbw(int32_t offset, const uint8_t *data, int32_t count) {
+  this->write_raw_<4>(offset, data, count, false);
+}
+
+template<int Channels>
+void AddressableLight::write_raw_(int32_t offset, const uint8_t *data, int32_t count, bool white_from_rgb) {
+  if (offset < 0 || offset >= this->size())
+    return;
+  count = std::min(count, this->size() - offset);
+
+  const uint8_t *lut = this->get_correction_lut_();
+  const uint8_t *red = lut, *green = lut + 256, *blue = lut + 512, *white = lut + 768;
+  for (int32_t i = 0; i < count; i++, data += Channels) {
+    uint8_t w = 0;
+    if (Channels == 4) {
+      w = data[3];
+    } else if (white_from_rgb) {
+      w = std::min(std::min(data[0], data[1]), data[2]);
+    }
+    this->get_view_internal(offset + i).raw_set_rgbw(red[data[0]], green[data[1]], blue[data[2]], white[w]);
+  }
+}
+
+const uint8_t *AddressableLight::get_correction_lut_() {
+  const Color &max_brightness = this->correction_.get_max_brightness();
+  const uint8_t local_brightness = this->correction_.get_local_brightness();
+  if (this->correction_lut_ && this->correction_lut_max_brightness_ == max_brightness &&
+      this->correction_lut_local_brightness_ == local_brightness)
+    return this->correction_lut_.get();
+
+  if (!this->correction_lut_)
+    this->correction_lut_.reset(new uint8_t[4 * 256]);
+  uint8_t *lut = this->correction_lut_.get();
+  for (int i = 0; i < 256; i++) {
+    lut[i] = this->correction_.color_correct_red(i);
+    lut[256 + i] = this->correction_.color_correct_green(i);
+    lut[512 + i] = this->correction_.color_correct_blue(i);
+    lut[768 + i] = this->correction_.color_correct_white(i);
+  }
+  this->correction_lut_max_brightness_ = max_brightness;
+  this->correction_lut_local_brightness_ = local_brightness;
+  return lut;
+}
+
 Color color_from_light_color_values(LightColorValues val) {
   auto r = to_uint8_scale(val.get_color_brightness() * val.get_red());
   auto g = to_uint8_scale(val.get_color_brightness() * val.get_green());
@@ -70,11 +70,22 @@ class AddressableLight : public LightOutput, public Component {
   }
   void setup_state(LightState *state) override {
     this->correction_.calculate_gamma_table(state->get_gamma_correct());
+    this->correction_lut_.reset();
     this->state_parent_ = state;
   }
   void update_state(LightState *state) override;
   void schedule_show() { this->state_parent_->next_write_ = true; }
 
+  /** Set \p count LEDs starting at \p offset from packed RGB data, 3 bytes per LED.
+   *
+   * Gives the same result as setting each LED through operator[], but much faster for long strips: the color correction
+   * is looked up in a table and the data isn't unpacked into a Color first. LEDs beyond the end of the strip are
+   * ignored. The white channel is set to 0, or to the minimum of red, green and blue if \p white_from_rgb is set.
+   */
+  void write_rgb(int32_t offset, const uint8_t *data, int32_t count, bool white_from_rgb = false);
+  /// Set \p count LEDs starting at \p offset from packed RGBW data, 4 bytes per LED. See write_rgb().
+  void write_rgbw(int32_t offset, const uint8_t *data, int32_t count);
+
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
 #endif
@@ -96,9 +107,15 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  template<int Channels> void write_raw_(int32_t offset, const uint8_t *data, int32_t count, bool white_from_rgb);
+  const uint8_t *get_correction_lut_();
 
   bool effect_active_{false};
   ESPColorCorrection correction_{};
+  /// The corrected value of every input value, for red, green, blue and white. Only allocated once written to in bulk.
+  std::unique_ptr<uint8_t[]> correction_lut_;
+  Color correction_lut_max_brightness_{};
+  uint8_t correction_lut_local_brightness_{0};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
 #endif
@@ -48,6 +48,37 @@ class AddressableLightEffect : public LightEffect {
   AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
 };
 
+/** Base class for effects that show LED data received from elsewhere, like WLED over UDP or Adalight over UART.
+ *
+ * Implementations should drain everything that was received in apply(), parse it straight from the shared receive
+ * buffer, write the LEDs in bulk with AddressableLight::write_rgb()/write_rgbw() and schedule a single show afterwards.
+ */
+class AddressableStreamLightEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableStreamLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+  void stop() override {
+    this->buffer_.clear();
+    this->buffer_.shrink_to_fit();
+    AddressableLightEffect::stop();
+  }
+
+ protected:
+  /// The receive buffer, reused for every packet or frame while the effect runs. Grows to hold at least `size` bytes.
+  uint8_t *get_buffer_(size_t size) {
+    if (this->buffer_.size() < size)
+      this->buffer_.resize(size);
+    return this->buffer_.data();
+  }
+  void blank_all_leds_(AddressableLight &it) {
+    for (int led = it.size(); led-- > 0;) {
+      it[led].set(Color::BLACK);
+    }
+    it.schedule_show();
+  }
+
+  std::vector<uint8_t> buffer_;
+};
+
 class AddressableLambdaLightEffect : public AddressableLightEffect {
  public:
   AddressableLambdaLightEffect(const std::string &name,
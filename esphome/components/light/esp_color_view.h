@@ -93,6 +93,14 @@ class ESPColorView : public ESPColorSettable {
       return 0;
     return *this->effect_data_;
   }
+  /// Set the already color corrected values, as returned by the get_*_raw() methods.
+  void raw_set_rgbw(uint8_t red, uint8_t green, uint8_t blue, uint8_t white) {
+    *this->red_ = red;
+    *this->green_ = green;
+    *this->blue_ = blue;
+    if (this->white_ != nullptr)
+      *this->white_ = white;
+  }
   void raw_set_color_correction(const ESPColorCorrection *color_correction) {
     this->color_correction_ = color_correction;
   }
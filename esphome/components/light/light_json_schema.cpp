@@ -8,7 +8,7 @@ namespace light {
 
 // See https://www.home-assistant.io/integrations/light.mqtt/#json-schema for documentation on the schema
 
-void LightJSONSchema::dump_json(LightState &state, JsonObject root) {
+void LightJSONSchema::dump_json(LightState &state, json::JsonWriter &root) {
   if (state.supports_effects())
     root["effect"] = state.get_effect_name();
 
@@ -52,24 +52,27 @@ void LightJSONSchema::dump_json(LightState &state, JsonObject root) {
   if (values.get_color_mode() & ColorCapability::BRIGHTNESS)
     root["brightness"] = uint8_t(values.get_brightness() * 255);
 
-  JsonObject color = root.createNestedObject("color");
+  // the color object is streamed, so it has to be complete before any other member is written
+  root.begin_object("color");
   if (values.get_color_mode() & ColorCapability::RGB) {
-    color["r"] = uint8_t(values.get_color_brightness() * values.get_red() * 255);
-    color["g"] = uint8_t(values.get_color_brightness() * values.get_green() * 255);
-    color["b"] = uint8_t(values.get_color_brightness() * values.get_blue() * 255);
+    root["r"] = uint8_t(values.get_color_brightness() * values.get_red() * 255);
+    root["g"] = uint8_t(values.get_color_brightness() * values.get_green() * 255);
+    root["b"] = uint8_t(values.get_color_brightness() * values.get_blue() * 255);
   }
   if (values.get_color_mode() & ColorCapability::WHITE) {
-    color["w"] = uint8_t(values.get_white() * 255);
-    root["white_value"] = uint8_t(values.get_white() * 255);  // legacy API
+    root["w"] = uint8_t(values.get_white() * 255);
+  } else if (values.get_color_mode() & ColorCapability::COLD_WARM_WHITE) {
+    root["c"] = uint8_t(values.get_cold_white() * 255);
+    root["w"] = uint8_t(values.get_warm_white() * 255);
   }
+  root.end_object();
+
+  if (values.get_color_mode() & ColorCapability::WHITE)
+    root["white_value"] = uint8_t(values.get_white() * 255);  // legacy API
   if (values.get_color_mode() & ColorCapability::COLOR_TEMPERATURE) {
     // this one isn't under the color subkey for some reason
     root["color_temp"] = uint32_t(values.get_color_temperature());
   }
-  if (values.get_color_mode() & ColorCapability::COLD_WARM_WHITE) {
-    color["c"] = uint8_t(values.get_cold_white() * 255);
-    color["w"] = uint8_t(values.get_warm_white() * 255);
-  }
 }
 
 void LightJSONSchema::parse_color_json(LightState &state, LightCall &call, JsonObject root) {
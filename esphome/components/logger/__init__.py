@@ -40,6 +40,7 @@ from esphome.components.libretiny.const import (
 )
 
 CODEOWNERS = ["@esphome/core"]
+CONF_DEFERRED_BUFFER_SIZE = "deferred_buffer_size"
 logger_ns = cg.esphome_ns.namespace("logger")
 LOG_LEVELS = {
     "NONE": cg.global_ns.ESPHOME_LOG_LEVEL_NONE,
@@ -164,6 +165,9 @@ CONFIG_SCHEMA = cv.All(
             cv.GenerateID(): cv.declare_id(Logger),
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
             cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+            cv.Optional(CONF_DEFERRED_BUFFER_SIZE): cv.All(
+                cv.validate_bytes, cv.int_range(min=256)
+            ),
             cv.Optional(CONF_DEASSERT_RTS_DTR, default=False): cv.boolean,
             cv.SplitDefault(
                 CONF_HARDWARE_UART,
@@ -216,6 +220,9 @@ async def to_code(config):
             )
         )
     cg.add(log.pre_setup())
+    if CONF_DEFERRED_BUFFER_SIZE in config:
+        cg.add_define("USE_LOGGER_DEFERRED")
+        cg.add(log.set_deferred_buffer_size(config[CONF_DEFERRED_BUFFER_SIZE]))
 
     for tag, level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
@@ -112,6 +112,20 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   this->set_null_terminator_();
 
   const char *msg = this->tx_buffer_ + offset;
+#ifdef USE_LOGGER_DEFERRED
+  if (this->deferred_buffer_ != nullptr) {
+    if (level >= ESPHOME_LOG_LEVEL_DEBUG) {
+      this->defer_message_(level, tag, msg);
+      return;
+    }
+    // keep the order, the queued messages go first; other tasks write right away and leave them to loop()
+    if (this->is_loop_task_())
+      this->flush_deferred_();
+  }
+#endif
+  this->write_message_(level, tag, msg);
+}
+void HOT Logger::write_message_(int level, const char *tag, const char *msg) {
   if (this->baud_rate_ > 0) {
 #ifdef USE_ARDUINO
     this->hw_serial_->println(msg);
@@ -309,6 +323,109 @@ void Logger::pre_setup() {
 }
 #endif  // USE_LIBRETINY
 
+#ifdef USE_LOGGER_DEFERRED
+static const uint16_t DEFERRED_WRAP = 0xFFFF;
+
+void Logger::set_deferred_buffer_size(size_t size) {
+  this->deferred_buffer_ = new uint8_t[size];  // NOLINT
+  this->deferred_size_ = size;
+  // messages are copied from tx_buffer_, so they are never longer than it
+  this->deferred_message_ = new char[this->tx_buffer_size_ + 1];  // NOLINT
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  this->loop_task_ = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+bool Logger::is_loop_task_() const {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  return xTaskGetCurrentTaskHandle() == this->loop_task_;
+#else
+  // the other platforms run everything that logs on the loop task
+  return true;
+#endif
+}
+
+void HOT Logger::defer_message_(int level, const char *tag, const char *msg) {
+  const size_t length = strlen(msg) + 1;
+  const size_t needed = sizeof(DeferredHeader) + length;
+  const size_t size = this->deferred_size_;
+  size_t head = this->deferred_head_.load(std::memory_order_relaxed);
+  const size_t tail = this->deferred_tail_.load(std::memory_order_acquire);
+
+  // One byte always stays free, so that head == tail means empty.
+  size_t pos;
+  if (head >= tail && size - head >= needed + (tail == 0 ? 1 : 0)) {
+    pos = head;
+  } else if (head >= tail && tail > needed) {
+    // wrap around, loop() skips the rest of the buffer when it finds the marker or too little space for a header
+    if (size - head >= sizeof(DeferredHeader)) {
+      DeferredHeader wrap{DEFERRED_WRAP, 0, nullptr};
+      memcpy(this->deferred_buffer_ + head, &wrap, sizeof(wrap));
+    }
+    pos = 0;
+  } else if (head < tail && tail - head > needed) {
+    pos = head;
+  } else {
+    this->dropped_count_++;
+    this->dropped_unreported_++;
+    return;
+  }
+
+  DeferredHeader header{static_cast<uint16_t>(length), static_cast<uint8_t>(level), tag};
+  memcpy(this->deferred_buffer_ + pos, &header, sizeof(header));
+  memcpy(this->deferred_buffer_ + pos + sizeof(header), msg, length);
+  pos += needed;
+  if (pos == size)
+    pos = 0;
+  this->deferred_head_.store(pos, std::memory_order_release);
+#ifdef USE_TICKLESS_LOOP
+  this->wake();
+#endif
+}
+
+void Logger::flush_deferred_() {
+  // Like for direct messages, log calls from the callbacks are dropped. They must not drain the buffer again.
+  const bool recursion_guard = this->recursion_guard_;
+  this->recursion_guard_ = true;
+
+  const size_t head = this->deferred_head_.load(std::memory_order_acquire);
+  size_t tail = this->deferred_tail_.load(std::memory_order_relaxed);
+  while (tail != head) {
+    DeferredHeader header;
+    if (this->deferred_size_ - tail >= sizeof(header))
+      memcpy(&header, this->deferred_buffer_ + tail, sizeof(header));
+    if (this->deferred_size_ - tail < sizeof(header) || header.length == DEFERRED_WRAP) {
+      tail = 0;
+      continue;
+    }
+    // Copy the message out and release its space before writing it, the callbacks may take a while
+    memcpy(this->deferred_message_, this->deferred_buffer_ + tail + sizeof(header), header.length);
+    tail += sizeof(header) + header.length;
+    if (tail == this->deferred_size_)
+      tail = 0;
+    this->deferred_tail_.store(tail, std::memory_order_release);
+    this->write_message_(header.level, header.tag, this->deferred_message_);
+  }
+
+  if (this->dropped_unreported_ != 0) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s[W][%s]: %" PRIu32 " log messages dropped" ESPHOME_LOG_RESET_COLOR,
+             LOG_LEVEL_COLORS[ESPHOME_LOG_LEVEL_WARN], TAG, this->dropped_unreported_);
+    this->dropped_unreported_ = 0;
+    this->write_message_(ESPHOME_LOG_LEVEL_WARN, TAG, buf);
+  }
+
+  this->recursion_guard_ = recursion_guard;
+}
+
+void Logger::loop() {
+  this->flush_deferred_();
+#ifdef USE_TICKLESS_LOOP
+  this->idle();
+#endif
+}
+#endif  // USE_LOGGER_DEFERRED
+
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
@@ -360,6 +477,9 @@ void Logger::dump_config() {
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
+#ifdef USE_LOGGER_DEFERRED
+  ESP_LOGCONFIG(TAG, "  Deferred Buffer Size: %zu", this->deferred_size_);
+#endif
 }
 void Logger::write_footer_() { this->write_to_buffer_(ESPHOME_LOG_RESET_COLOR, strlen(ESPHOME_LOG_RESET_COLOR)); }
 
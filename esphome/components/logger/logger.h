@@ -7,6 +7,17 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
 
+#ifdef USE_LOGGER_DEFERRED
+#include <atomic>
+#if defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(USE_LIBRETINY)
+#include <FreeRTOS.h>
+#include <task.h>
+#endif
+#endif
+
 #ifdef USE_ARDUINO
 #if defined(USE_ESP8266) || defined(USE_ESP32)
 #include <HardwareSerial.h>
@@ -85,6 +96,22 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+#ifdef USE_LOGGER_DEFERRED
+  /** Queue DEBUG and more verbose messages in a ring buffer of \p size bytes and write them out in loop().
+   *
+   * Messages are still formatted by the caller, but writing them to the UART and calling the log callbacks (API,
+   * MQTT, web server, ...) happens in loop(). CONFIG, INFO, WARN and ERROR messages are written right away, on the
+   * loop task after writing out the queued ones. Other tasks never drain the buffer. When the buffer is full, messages
+   * are dropped and counted.
+   *
+   * Must be called from the loop task.
+   */
+  void set_deferred_buffer_size(size_t size);
+  void loop() override;
+  /// Number of messages dropped because the deferred buffer was full.
+  uint32_t get_dropped_count() const { return this->dropped_count_; }
+#endif
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
@@ -107,6 +134,14 @@ class Logger : public Component {
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
   void log_message_(int level, const char *tag, int offset = 0);
+  /// Write a finished message to the UART and the log callbacks.
+  void write_message_(int level, const char *tag, const char *msg);
+#ifdef USE_LOGGER_DEFERRED
+  void defer_message_(int level, const char *tag, const char *msg);
+  void flush_deferred_();
+  /// Whether the caller runs on the loop task, the only consumer of the deferred buffer.
+  bool is_loop_task_() const;
+#endif
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -170,6 +205,29 @@ class Logger : public Component {
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
   /// Prevents recursive log calls, if true a log message is already being processed.
   bool recursion_guard_ = false;
+#ifdef USE_LOGGER_DEFERRED
+  /// Header of a message in the deferred buffer, followed by the null terminated message.
+  struct DeferredHeader {
+    /// Length of the message including the null terminator, DEFERRED_WRAP if the next message is at offset 0.
+    uint16_t length;
+    uint8_t level;
+    const char *tag;
+  };
+  uint8_t *deferred_buffer_{nullptr};
+  size_t deferred_size_{0};
+  /// A deferred message is copied here before it is written, so its space in the buffer can be reused meanwhile.
+  char *deferred_message_{nullptr};
+  /// Offset of the next message to write, only changed by the logging side.
+  std::atomic<size_t> deferred_head_{0};
+  /// Offset of the next message to read, only changed by loop().
+  std::atomic<size_t> deferred_tail_{0};
+  uint32_t dropped_count_{0};
+  /// Drops not reported in the log yet.
+  uint32_t dropped_unreported_{0};
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t loop_task_{nullptr};
+#endif
+#endif
 };
 
 extern Logger *global_logger;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
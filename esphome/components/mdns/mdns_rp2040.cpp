@@ -34,9 +34,19 @@ void MDNSComponent::setup() {
       MDNS.addServiceTxt(service_type, proto, record.key.c_str(), record.value.c_str());
     }
   }
+
+#ifdef USE_TICKLESS_LOOP
+  this->set_interval("tickless_wake", 1000, [this]() { this->wake(); });
+#endif
 }
 
-void MDNSComponent::loop() { MDNS.update(); }
+void MDNSComponent::loop() {
+  MDNS.update();
+#ifdef USE_TICKLESS_LOOP
+  // Queries are answered from the UDP receive callback, update() only drives probing, announcing and the cache
+  this->idle();
+#endif
+}
 
 void MDNSComponent::on_shutdown() {
   MDNS.close();
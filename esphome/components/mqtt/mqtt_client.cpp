@@ -2,6 +2,7 @@
 
 #ifdef USE_MQTT
 
+#include <algorithm>
 #include <utility>
 #include "esphome/components/network/util.h"
 #include "esphome/core/application.h"
@@ -53,6 +54,17 @@ void MQTTClientComponent::setup() {
     this->state_ = MQTT_CLIENT_DISCONNECTED;
     this->disconnect_reason_ = reason;
   });
+  if (this->is_discovery_enabled()) {
+    // Home Assistant announces itself on <prefix>/status whenever it (re)connects to the broker. The broker may have
+    // lost the retained discovery messages in the meantime, so they are all published again.
+    this->subscribe(this->discovery_info_.prefix + "/status",
+                    [this](const std::string &topic, const std::string &payload) {
+                      if (payload != "online")
+                        return;
+                      this->discovery_index_ = 0;
+                      this->discovery_publish_all_ = true;
+                    });
+  }
 #ifdef USE_LOGGER
   if (this->is_log_message_enabled() && logger::global_logger != nullptr) {
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
@@ -290,8 +302,10 @@ void MQTTClientComponent::check_connected() {
   this->resubscribe_subscriptions_();
   this->send_device_info_();
 
+  // States are sent right away, discovery follows one message per loop
   for (MQTTComponent *component : this->children_)
     component->schedule_resend_state();
+  this->discovery_index_ = 0;
 }
 
 void MQTTClientComponent::loop() {
@@ -362,6 +376,7 @@ void MQTTClientComponent::loop() {
 
         this->last_connected_ = now;
         this->resubscribe_subscriptions_();
+        this->advance_discovery_();
       }
       break;
   }
@@ -373,6 +388,65 @@ void MQTTClientComponent::loop() {
 }
 float MQTTClientComponent::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
 
+// Discovery
+void MQTTClientComponent::advance_discovery_() {
+  if (!this->is_discovery_enabled())
+    return;
+  if (this->discovery_hashes_.size() < this->children_.size())
+    this->discovery_hashes_.resize(this->children_.size(), DiscoveryHash{{}, 0, false});
+
+  while (this->discovery_index_ < this->children_.size()) {
+    MQTTComponent *component = this->children_[this->discovery_index_];
+    if (component->is_internal() || !component->is_discovery_enabled()) {
+      this->discovery_index_++;
+      continue;
+    }
+
+    const std::string topic = component->get_discovery_topic_(this->discovery_info_);
+    DiscoveryHash &last = this->discovery_hashes_[this->discovery_index_];
+    if (!last.loaded) {
+      last.pref = global_preferences->make_preference<uint32_t>(fnv1_hash(topic));
+      if (!last.pref.load(&last.hash))
+        last.hash = 0;
+      last.loaded = true;
+    }
+
+    uint32_t hash = 0;
+    if (this->discovery_info_.clean) {
+      ESP_LOGV(TAG, "'%s': Cleaning discovery...", component->friendly_name().c_str());
+      this->json_buffer_.clear();
+    } else {
+      json::JsonWriter root(this->json_buffer_);
+      component->write_discovery_(root);
+      root.finish();
+      hash = fnv1_hash(this->json_buffer_);
+      if (this->discovery_info_.retain && !this->discovery_publish_all_ && hash == last.hash) {
+        // the broker still has this exact payload retained
+        ESP_LOGV(TAG, "'%s': Discovery unchanged", component->friendly_name().c_str());
+        this->discovery_index_++;
+        continue;
+      }
+      ESP_LOGV(TAG, "'%s': Sending discovery...", component->friendly_name().c_str());
+    }
+
+    // Cleaning always retains, so the empty payload replaces the retained config
+    const bool retain = this->discovery_info_.clean || this->discovery_info_.retain;
+    if (!this->publish(topic, this->json_buffer_, 0, retain)) {
+      // resume with this component on the next loop
+      return;
+    }
+    if (last.hash != hash) {
+      last.hash = hash;
+      last.pref.save(&last.hash);
+    }
+    this->discovery_index_++;
+    // one message per loop, so discovery can't crowd out state messages
+    return;
+  }
+  // the round is complete
+  this->discovery_publish_all_ = false;
+}
+
 // Subscribe
 bool MQTTClientComponent::subscribe_(const char *topic, uint8_t qos) {
   if (!this->is_connected())
@@ -417,6 +491,7 @@ void MQTTClientComponent::subscribe(const std::string &topic, mqtt_callback_t ca
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.insert(subscription.topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -432,6 +507,7 @@ void MQTTClientComponent::subscribe_json(const std::string &topic, const mqtt_js
       .resubscribe_timeout = 0,
   };
   this->resubscribe_subscription_(&subscription);
+  this->subscription_trie_.insert(subscription.topic, this->subscriptions_.size());
   this->subscriptions_.push_back(subscription);
 }
 
@@ -446,13 +522,12 @@ void MQTTClientComponent::unsubscribe(const std::string &topic) {
     this->status_momentary_warning("unsubscribe", 1000);
   }
 
-  auto it = subscriptions_.begin();
-  while (it != subscriptions_.end()) {
-    if (it->topic == topic) {
-      it = subscriptions_.erase(it);
-    } else {
-      ++it;
-    }
+  // from the back, so the ids of the subscriptions still to be checked don't move
+  for (size_t i = this->subscriptions_.size(); i-- > 0;) {
+    if (this->subscriptions_[i].topic != topic)
+      continue;
+    this->subscription_trie_.remove(topic, i);
+    this->subscriptions_.erase(this->subscriptions_.begin() + i);
   }
 }
 
@@ -497,62 +572,10 @@ bool MQTTClientComponent::publish_json(const std::string &topic, const json::jso
   std::string message = json::build_json(f);
   return this->publish(topic, message, qos, retain);
 }
-
-/** Check if the message topic matches the given subscription topic
- *
- * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
- *
- * @param message The message topic that was received from the MQTT server. Note: this must not contain
- *                wildcard characters as mandated by the MQTT spec.
- * @param subscription The subscription topic we are matching against.
- * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
- * @param past_separator Are we past the first '/' topic separator.
- * @return true if the subscription topic matches the message topic, false otherwise.
- */
-static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
-  // Reached end of both strings at the same time, this means we have a successful match
-  if (*message == '\0' && *subscription == '\0')
-    return true;
-
-  // Either the message or the subscribe are at the end. This means they don't match.
-  if (*message == '\0' || *subscription == '\0')
-    return false;
-
-  bool do_wildcards = is_normal || past_separator;
-
-  if (*subscription == '+' && do_wildcards) {
-    // single level wildcard
-    // consume + from subscription
-    subscription++;
-    // consume everything from message until '/' found or end of string
-    while (*message != '\0' && *message != '/') {
-      message++;
-    }
-    // after this, both pointers will point to a '/' or to the end of the string
-
-    return topic_match(message, subscription, is_normal, true);
-  }
-
-  if (*subscription == '#' && do_wildcards) {
-    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
-    return true;
-  }
-
-  // this handles '/' and normal characters at the same time.
-  if (*message != *subscription)
-    return false;
-
-  past_separator = past_separator || *subscription == '/';
-
-  // consume characters
-  subscription++;
-  message++;
-
-  return topic_match(message, subscription, is_normal, past_separator);
-}
-
-static bool topic_match(const char *message, const char *subscription) {
-  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+bool MQTTClientComponent::publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos,
+                                       bool retain) {
+  json::write_json(this->json_buffer_, f);
+  return this->publish(topic, this->json_buffer_, qos, retain);
 }
 
 void MQTTClientComponent::on_message(const std::string &topic, const std::string &payload) {
@@ -561,9 +584,14 @@ void MQTTClientComponent::on_message(const std::string &topic, const std::string
   // from a different task.
   this->defer([this, topic, payload]() {
 #endif
-    for (auto &subscription : this->subscriptions_) {
-      if (topic_match(topic.c_str(), subscription.topic.c_str()))
-        subscription.callback(topic, payload);
+    this->subscription_matches_.clear();
+    this->subscription_trie_.match(topic, this->subscription_matches_);
+    // call back in subscription order, like matching the subscriptions one by one would
+    std::sort(this->subscription_matches_.begin(), this->subscription_matches_.end());
+    for (uint16_t id : this->subscription_matches_) {
+      // a callback may have unsubscribed
+      if (id < this->subscriptions_.size())
+        this->subscriptions_[id].callback(topic, payload);
     }
 #ifdef USE_ESP8266
   });
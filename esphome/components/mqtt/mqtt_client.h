@@ -7,6 +7,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/automation.h"
 #include "esphome/core/log.h"
+#include "esphome/core/preferences.h"
 #include "esphome/components/json/json_util.h"
 #include "esphome/components/network/ip_address.h"
 #if defined(USE_ESP32)
@@ -14,6 +15,7 @@
 #elif defined(USE_ESP8266)
 #include "mqtt_backend_esp8266.h"
 #endif
+#include "mqtt_topic_trie.h"
 #include "lwip/ip_addr.h"
 
 #include <vector>
@@ -220,6 +222,14 @@ class MQTTClientComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f, uint8_t qos = 0, bool retain = false);
 
+  /** Stream a JSON MQTT message into a reused buffer and send it.
+   *
+   * @param topic The topic.
+   * @param f The Json Message writer.
+   * @param retain Whether to retain the message.
+   */
+  bool publish_json(const std::string &topic, const json::json_write_t &f, uint8_t qos = 0, bool retain = false);
+
   /// Setup the MQTT client, registering a bunch of callbacks and attempting to connect.
   void setup() override;
   void dump_config() override;
@@ -252,6 +262,8 @@ class MQTTClientComponent : public Component {
 
  protected:
   void send_device_info_();
+  /// Publish the next discovery message, if any are left in the current round.
+  void advance_discovery_();
 
   /// Reconnect to the MQTT broker if not already connected.
   void start_connect_();
@@ -293,9 +305,15 @@ class MQTTClientComponent : public Component {
   std::string topic_prefix_{};
   MQTTMessage log_message_;
   std::string payload_buffer_;
+  /// Output of publish_json() with a JsonWriter, kept between messages so it doesn't have to grow again.
+  std::string json_buffer_;
   int log_level_{ESPHOME_LOG_LEVEL};
 
   std::vector<MQTTSubscription> subscriptions_;
+  /// Topic filters of subscriptions_, by index.
+  MQTTTopicTrie subscription_trie_;
+  /// Scratch list of subscriptions matching the current message, kept to avoid allocating per message.
+  std::vector<uint16_t> subscription_matches_;
 #if defined(USE_ESP32)
   MQTTBackendESP32 mqtt_backend_;
 #elif defined(USE_ESP8266)
@@ -307,6 +325,24 @@ class MQTTClientComponent : public Component {
   bool dns_resolved_{false};
   bool dns_resolve_error_{false};
   std::vector<MQTTComponent *> children_;
+  /// Index into children_ of the next component to publish discovery for.
+  size_t discovery_index_{0};
+  /** Hash of the last discovery payload published for a component, 0 if unknown.
+   *
+   * Persisted, so retained payloads already on the broker aren't sent again after a reconnect or reboot.
+   */
+  struct DiscoveryHash {
+    ESPPreferenceObject pref;
+    uint32_t hash;
+    bool loaded;
+  };
+  /// Discovery hashes of children_, by index.
+  std::vector<DiscoveryHash> discovery_hashes_;
+  /** Publish every discovery message of the current round, even if its hash is unchanged.
+   *
+   * Set when Home Assistant comes online: it may have connected to a broker that lost its retained messages.
+   */
+  bool discovery_publish_all_{false};
   uint32_t reboot_timeout_{300000};
   uint32_t connect_begin_;
   uint32_t last_connected_{0};
@@ -58,6 +58,8 @@ struct SendDiscoveryConfig {
  * a clean separation.
  */
 class MQTTComponent : public Component {
+  friend class MQTTClientComponent;
+
  public:
   /// Constructs a MQTTComponent.
   explicit MQTTComponent();
@@ -70,7 +72,7 @@ class MQTTComponent : public Component {
   void call_dump_config() override;
 
   /// Send discovery info the Home Assistant, override this.
-  virtual void send_discovery(JsonObject root, SendDiscoveryConfig &config) = 0;
+  virtual void send_discovery(json::JsonWriter &root, SendDiscoveryConfig &config) = 0;
 
   virtual bool send_initial_state() = 0;
 
@@ -121,6 +123,13 @@ class MQTTComponent : public Component {
    */
   bool publish_json(const std::string &topic, const json::json_build_t &f);
 
+  /** Stream and send a JSON MQTT message.
+   *
+   * @param topic The topic.
+   * @param f The Json Message writer.
+   */
+  bool publish_json(const std::string &topic, const json::json_write_t &f);
+
   /** Subscribe to a MQTT topic.
    *
    * @param topic The topic. Wildcards are currently not supported.
@@ -180,8 +189,8 @@ class MQTTComponent : public Component {
 
   bool is_connected_() const;
 
-  /// Internal method to start sending discovery info, this will call send_discovery().
-  bool send_discovery_();
+  /// Internal method for the MQTT client to build the discovery payload, this will call send_discovery().
+  void write_discovery_(json::JsonWriter &root);
 
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
@@ -44,7 +44,7 @@ void MQTTSwitchComponent::dump_config() {
 
 std::string MQTTSwitchComponent::component_type() const { return "switch"; }
 const EntityBase *MQTTSwitchComponent::get_entity() const { return this->switch_; }
-void MQTTSwitchComponent::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTSwitchComponent::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   if (this->switch_->assumed_state())
     root[MQTT_OPTIMISTIC] = true;
 }
@@ -12,7 +12,7 @@ static const char *const TAG = "mqtt.text_sensor";
 using namespace esphome::text_sensor;
 
 MQTTTextSensor::MQTTTextSensor(TextSensor *sensor) : sensor_(sensor) {}
-void MQTTTextSensor::send_discovery(JsonObject root, mqtt::SendDiscoveryConfig &config) {
+void MQTTTextSensor::send_discovery(json::JsonWriter &root, mqtt::SendDiscoveryConfig &config) {
   config.command_topic = false;
 }
 void MQTTTextSensor::setup() {
@@ -0,0 +1,272 @@
+#include "mqtt_topic_trie.h"
+
+#ifdef USE_MQTT
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace mqtt {
+
+/** Check if the message topic matches the given subscription topic
+ *
+ * INFO: MQTT spec mandates that topics must not be empty and must be valid NULL-terminated UTF-8 strings.
+ *
+ * @param message The message topic that was received from the MQTT server. Note: this must not contain
+ *                wildcard characters as mandated by the MQTT spec.
+ * @param subscription The subscription topic we are matching against.
+ * @param is_normal Is this a "normal" topic - Does the message topic not begin with a "$".
+ * @param past_separator Are we past the first '/' topic separator.
+ * @return true if the subscription topic matches the message topic, false otherwise.
+ */
+static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
+  // Reached end of both strings at the same time, this means we have a successful match
+  if (*message == '\0' && *subscription == '\0')
+    return true;
+
+  // Either the message or the subscribe are at the end. This means they don't match.
+  if (*message == '\0' || *subscription == '\0')
+    return false;
+
+  bool do_wildcards = is_normal || past_separator;
+
+  if (*subscription == '+' && do_wildcards) {
+    // single level wildcard
+    // consume + from subscription
+    subscription++;
+    // consume everything from message until '/' found or end of string
+    while (*message != '\0' && *message != '/') {
+      message++;
+    }
+    // after this, both pointers will point to a '/' or to the end of the string
+
+    return topic_match(message, subscription, is_normal, true);
+  }
+
+  if (*subscription == '#' && do_wildcards) {
+    // multilevel wildcard - MQTT mandates that this must be at end of subscribe topic
+    return true;
+  }
+
+  // this handles '/' and normal characters at the same time.
+  if (*message != *subscription)
+    return false;
+
+  past_separator = past_separator || *subscription == '/';
+
+  // consume characters
+  subscription++;
+  message++;
+
+  return topic_match(message, subscription, is_normal, past_separator);
+}
+
+static bool topic_match(const char *message, const char *subscription) {
+  return topic_match(message, subscription, *message != '\0' && *message != '$', false);
+}
+
+MQTTTopicTrie::MQTTTopicTrie() { this->clear(); }
+
+void MQTTTopicTrie::clear() {
+  this->nodes_.clear();
+  this->nodes_.emplace_back();
+  this->free_nodes_.clear();
+  this->unindexed_.clear();
+}
+
+void MQTTTopicTrie::insert(const std::string &filter, uint16_t id) {
+  const char *end = filter.c_str() + filter.size();
+
+  // Only filters whose wildcards are whole levels, with '#' as the last level, follow the level structure
+  for (const char *level = filter.c_str();;) {
+    const char *level_end = std::find(level, end, '/');
+    const size_t length = level_end - level;
+    const bool plus = std::find(level, level_end, '+') != level_end;
+    const bool hash = std::find(level, level_end, '#') != level_end;
+    if (((plus || hash) && length != 1) || (hash && level_end != end)) {
+      this->unindexed_.emplace_back(filter, id);
+      return;
+    }
+    if (level_end == end)
+      break;
+    level = level_end + 1;
+  }
+
+  uint16_t node = 0;
+  for (const char *level = filter.c_str();;) {
+    const char *level_end = std::find(level, end, '/');
+    const size_t length = level_end - level;
+    if (length == 1 && *level == '#') {
+      this->nodes_[node].hash_ids.push_back(id);
+      return;
+    }
+    if (length == 1 && *level == '+') {
+      if (this->nodes_[node].plus == NO_NODE) {
+        // take the index first, add_node_() may move the nodes
+        const uint16_t plus = this->add_node_();
+        this->nodes_[node].plus = plus;
+      }
+      node = this->nodes_[node].plus;
+    } else {
+      node = this->get_or_add_child_(node, level, length);
+    }
+    if (level_end == end)
+      break;
+    level = level_end + 1;
+  }
+  this->nodes_[node].ids.push_back(id);
+}
+
+std::vector<uint16_t>::const_iterator MQTTTopicTrie::lower_bound_child_(const std::vector<uint16_t> &children,
+                                                                        const char *level, size_t length) const {
+  return std::lower_bound(children.begin(), children.end(), 0, [this, level, length](uint16_t child, int) {
+    return this->nodes_[child].level.compare(0, std::string::npos, level, length) < 0;
+  });
+}
+
+uint16_t MQTTTopicTrie::find_child_(uint16_t node, const char *level, size_t length) const {
+  const auto &children = this->nodes_[node].children;
+  auto it = this->lower_bound_child_(children, level, length);
+  if (it != children.end() && this->nodes_[*it].level.compare(0, std::string::npos, level, length) == 0)
+    return *it;
+  return NO_NODE;
+}
+
+uint16_t MQTTTopicTrie::get_or_add_child_(uint16_t node, const char *level, size_t length) {
+  auto &children = this->nodes_[node].children;
+  auto it = this->lower_bound_child_(children, level, length);
+  if (it != children.end() && this->nodes_[*it].level.compare(0, std::string::npos, level, length) == 0)
+    return *it;
+
+  const size_t position = it - children.begin();
+  // children is invalidated from here on
+  const uint16_t child = this->add_node_();
+  auto &parent = this->nodes_[node];
+  parent.children.insert(parent.children.begin() + position, child);
+  this->nodes_[child].level.assign(level, length);
+  return child;
+}
+
+uint16_t MQTTTopicTrie::add_node_() {
+  if (!this->free_nodes_.empty()) {
+    const uint16_t node = this->free_nodes_.back();
+    this->free_nodes_.pop_back();
+    return node;
+  }
+  this->nodes_.emplace_back();
+  return static_cast<uint16_t>(this->nodes_.size() - 1);
+}
+
+static bool erase_id(std::vector<uint16_t> &ids, uint16_t id) {
+  auto it = std::find(ids.begin(), ids.end(), id);
+  if (it == ids.end())
+    return false;
+  ids.erase(it);
+  return true;
+}
+
+bool MQTTTopicTrie::remove(const std::string &filter, uint16_t id) {
+  bool removed = false;
+  for (auto it = this->unindexed_.begin(); it != this->unindexed_.end(); ++it) {
+    if (it->second == id && it->first == filter) {
+      this->unindexed_.erase(it);
+      removed = true;
+      break;
+    }
+  }
+  if (!removed)
+    removed = this->remove_(0, filter.c_str(), filter.c_str() + filter.size(), id);
+  if (!removed)
+    return false;
+
+  // the ids after the removed one move down, like the subscriptions they index
+  auto renumber = [id](std::vector<uint16_t> &ids) {
+    for (auto &other : ids) {
+      if (other > id)
+        other--;
+    }
+  };
+  for (auto &node : this->nodes_) {
+    renumber(node.ids);
+    renumber(node.hash_ids);
+  }
+  for (auto &it : this->unindexed_) {
+    if (it.second > id)
+      it.second--;
+  }
+  return true;
+}
+
+/// Remove \p id from the filter starting at \p level below \p node, and prune the nodes it leaves empty.
+bool MQTTTopicTrie::remove_(uint16_t node, const char *level, const char *end, uint16_t id) {
+  const char *level_end = std::find(level, end, '/');
+  const size_t length = level_end - level;
+  if (length == 1 && *level == '#')
+    return erase_id(this->nodes_[node].hash_ids, id);
+
+  const bool plus = length == 1 && *level == '+';
+  const uint16_t child = plus ? this->nodes_[node].plus : this->find_child_(node, level, length);
+  if (child == NO_NODE)
+    return false;
+  const bool removed =
+      level_end == end ? erase_id(this->nodes_[child].ids, id) : this->remove_(child, level_end + 1, end, id);
+
+  Node &c = this->nodes_[child];
+  if (removed && c.ids.empty() && c.hash_ids.empty() && c.children.empty() && c.plus == NO_NODE) {
+    if (plus) {
+      this->nodes_[node].plus = NO_NODE;
+    } else {
+      auto &children = this->nodes_[node].children;
+      children.erase(std::find(children.begin(), children.end(), child));
+    }
+    c.level.clear();
+    this->free_nodes_.push_back(child);
+  }
+  return removed;
+}
+
+void MQTTTopicTrie::match(const std::string &topic, std::vector<uint16_t> &matches) const {
+  const char *begin = topic.c_str();
+  const char *end = begin + topic.size();
+  // Like topic_match(), wildcards in the first level don't match topics starting with '$'
+  this->match_(0, begin, end, begin != end && *begin != '$', matches);
+
+  for (const auto &it : this->unindexed_) {
+    if (topic_match(begin, it.first.c_str()))
+      matches.push_back(it.second);
+  }
+}
+
+/** Collect the filters below \p node matching the rest of the topic.
+ *
+ * @param level The start of the next topic level, or nullptr if all levels have been matched. An empty topic
+ *              level (as in "a//b" or "a/") is still a level, and level == end for a trailing empty level.
+ */
+void MQTTTopicTrie::match_(uint16_t node, const char *level, const char *end, bool wildcards,
+                           std::vector<uint16_t> &matches) const {
+  const Node &n = this->nodes_[node];
+  if (level == nullptr) {
+    matches.insert(matches.end(), n.ids.begin(), n.ids.end());
+    return;
+  }
+
+  const char *level_end = std::find(level, end, '/');
+  const char *next = level_end == end ? nullptr : level_end + 1;
+
+  // Like topic_match(), wildcards need at least one more character of the topic, so "a/+" and "a/#"
+  // match neither "a" nor "a/"
+  if (wildcards && level != end) {
+    matches.insert(matches.end(), n.hash_ids.begin(), n.hash_ids.end());
+    if (n.plus != NO_NODE)
+      this->match_(n.plus, next, end, true, matches);
+  }
+
+  const uint16_t child = this->find_child_(node, level, level_end - level);
+  if (child != NO_NODE)
+    this->match_(child, next, end, true, matches);
+}
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
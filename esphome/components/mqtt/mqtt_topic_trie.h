@@ -0,0 +1,80 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MQTT
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esphome {
+namespace mqtt {
+
+/** Index of MQTT subscription topic filters, split into topic levels.
+ *
+ * Matching a message topic walks the trie one level at a time, following the exact level, the `+` node and
+ * collecting `#` filters along the way, so the cost depends on the depth of the topic instead of the number of
+ * subscriptions. Filters with wildcards that don't span a whole level (which the MQTT spec doesn't allow) are kept
+ * in a short list and matched character by character, exactly like before.
+ */
+class MQTTTopicTrie {
+ public:
+  MQTTTopicTrie();
+
+  /// Add the subscription \p id with topic filter \p filter.
+  void insert(const std::string &filter, uint16_t id);
+  /** Remove the subscription \p id with topic filter \p filter, false if there is none.
+   *
+   * Nodes left without subscriptions are pruned and reused by later inserts. Like the ids of a vector the ids are
+   * indices into, all ids greater than \p id move down by one.
+   */
+  bool remove(const std::string &filter, uint16_t id);
+  /// Remove all subscriptions.
+  void clear();
+  /** Append the ids of all subscriptions matching \p topic to \p matches.
+   *
+   * Each matching id is appended once, in no particular order.
+   */
+  void match(const std::string &topic, std::vector<uint16_t> &matches) const;
+
+ protected:
+  static const uint16_t NO_NODE = 0xFFFF;
+
+  struct Node {
+    std::string level;
+    /// Child nodes for exact topic levels, sorted by level.
+    std::vector<uint16_t> children;
+    /// Child node for the `+` wildcard.
+    uint16_t plus{NO_NODE};
+    /// Subscriptions whose filter ends at this node.
+    std::vector<uint16_t> ids;
+    /// Subscriptions whose filter is this node followed by `#`.
+    std::vector<uint16_t> hash_ids;
+  };
+
+  /// Position of the child for \p level in \p children, or where to insert it.
+  std::vector<uint16_t>::const_iterator lower_bound_child_(const std::vector<uint16_t> &children, const char *level,
+                                                          size_t length) const;
+  /// The child of \p node for the exact topic level \p level, NO_NODE if there is none.
+  uint16_t find_child_(uint16_t node, const char *level, size_t length) const;
+  uint16_t get_or_add_child_(uint16_t node, const char *level, size_t length);
+  /// A node from the free list, or a new one.
+  uint16_t add_node_();
+  bool remove_(uint16_t node, const char *level, const char *end, uint16_t id);
+  void match_(uint16_t node, const char *level, const char *end, bool wildcards,
+              std::vector<uint16_t> &matches) const;
+
+  /// All nodes, the root is nodes_[0].
+  std::vector<Node> nodes_;
+  /// Pruned nodes, which are not reachable from the root.
+  std::vector<uint16_t> free_nodes_;
+  /// Filters that can't be indexed by level, with their subscription id.
+  std::vector<std::pair<std::string, uint16_t>> unindexed_;
+};
+
+}  // namespace mqtt
+}  // namespace esphome
+
+#endif  // USE_MQTT
@@ -89,6 +89,16 @@ void OTAComponent::setup() {
     this->mark_failed();
     return;
   }
+  server_->set_wake_component(this);
+
+#ifdef USE_TICKLESS_LOOP
+  if (this->has_safe_mode_) {
+    // a successful boot is detected by time, make sure loop() runs when it is reached
+    const uint32_t elapsed = millis() - this->safe_mode_start_time_;
+    const uint32_t remaining = elapsed < this->safe_mode_enable_time_ ? this->safe_mode_enable_time_ - elapsed : 0;
+    this->set_timeout("tickless_safe_mode", remaining + 1, [this]() { this->wake(); });
+  }
+#endif
 
   this->dump_config();
 }
@@ -117,6 +127,12 @@ void OTAComponent::loop() {
     ESP_LOGI(TAG, "Boot seems successful, resetting boot loop counter.");
     this->clean_rtc();
   }
+
+#ifdef USE_TICKLESS_LOOP
+  // a new connection wakes the component through the server socket
+  if (this->client_ == nullptr)
+    this->idle();
+#endif
 }
 
 static const uint8_t FEATURE_SUPPORTS_COMPRESSION = 0x01;
@@ -8,12 +8,23 @@ preferences_ns = cg.esphome_ns.namespace("preferences")
 IntervalSyncer = preferences_ns.class_("IntervalSyncer", cg.Component)
 
 CONF_FLASH_WRITE_INTERVAL = "flash_write_interval"
+CONF_FLASH_WRITE_BUDGET = "flash_write_budget"
+CONF_MAX_WRITES = "max_writes"
+CONF_WINDOW = "window"
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(IntervalSyncer),
         cv.Optional(
             CONF_FLASH_WRITE_INTERVAL, default="60s"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_FLASH_WRITE_BUDGET): cv.Schema(
+            {
+                cv.Required(CONF_MAX_WRITES): cv.positive_not_null_int,
+                cv.Optional(
+                    CONF_WINDOW, default="1h"
+                ): cv.positive_not_null_time_period,
+            }
+        ),
     }
 ).extend(cv.COMPONENT_SCHEMA)
 
@@ -21,4 +32,11 @@ CONFIG_SCHEMA = cv.Schema(
 async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     cg.add(var.set_write_interval(config[CONF_FLASH_WRITE_INTERVAL]))
+    if CONF_FLASH_WRITE_BUDGET in config:
+        budget = config[CONF_FLASH_WRITE_BUDGET]
+        cg.add(
+            var.set_write_budget(
+                budget[CONF_MAX_WRITES], budget[CONF_WINDOW].total_milliseconds
+            )
+        )
     await cg.register_component(var, config)
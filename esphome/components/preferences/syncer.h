@@ -9,14 +9,21 @@ namespace preferences {
 class IntervalSyncer : public Component {
  public:
   void set_write_interval(uint32_t write_interval) { write_interval_ = write_interval; }
+  void set_write_budget(uint32_t max_writes, uint32_t window) {
+    max_writes_ = max_writes;
+    write_window_ = window;
+  }
   void setup() override {
-    set_interval(write_interval_, []() { global_preferences->sync(); });
+    global_preferences->set_write_budget(max_writes_, write_window_);
+    set_interval(write_interval_, []() { global_preferences->sync_within_budget(); });
   }
   void on_shutdown() override { global_preferences->sync(); }
   float get_setup_priority() const override { return setup_priority::BUS; }
 
  protected:
   uint32_t write_interval_;
+  uint32_t max_writes_{0};
+  uint32_t write_window_{0};
 };
 
 }  // namespace preferences
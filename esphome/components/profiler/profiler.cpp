@@ -0,0 +1,183 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+#include "esphome/core/application.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace profiler {
+
+static const char *const TAG = "profiler";
+
+const uint32_t PROFILER_HISTOGRAM_BOUNDS[PROFILER_HISTOGRAM_BUCKETS - 1] = {100, 1000, 5000, 20000, 50000};
+
+static const size_t PROFILER_MIN_SLOTS = 16;
+/// Milliseconds between the snapshots for copy_snapshot().
+static const uint32_t PROFILER_SNAPSHOT_INTERVAL = 1000;
+
+ProfilerComponent::ProfilerComponent() : reset_at_(millis()) { global_profiler = this; }
+
+void ProfilerComponent::setup() {
+  // room for the loop() and a couple of scheduler items of each component below the 3/4 load factor
+  size_t slots = PROFILER_MIN_SLOTS;
+  while (slots * 3 < App.get_components().size() * 4 * 4)
+    slots *= 2;
+  while (this->slots_.size() < slots)
+    this->grow_();
+}
+
+void ProfilerComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Profiler:");
+  LOG_UPDATE_INTERVAL(this);
+#ifdef USE_TEXT_SENSOR
+  LOG_TEXT_SENSOR("  ", "Summary", this->summary_);
+#endif
+}
+
+void ProfilerComponent::loop() {
+  const uint32_t now = millis();
+  if (now - this->snapshot_at_ < PROFILER_SNAPSHOT_INTERVAL)
+    return;
+  this->snapshot_at_ = now;
+  // collect outside of the lock, readers only wait for the swap
+  this->collect_stats_(this->snapshot_next_);
+  LockGuard guard(this->snapshot_lock_);
+  this->snapshot_.swap(this->snapshot_next_);
+}
+
+void ProfilerComponent::copy_snapshot(std::vector<ProfilerStats> &stats) {
+  LockGuard guard(this->snapshot_lock_);
+  stats.assign(this->snapshot_.begin(), this->snapshot_.end());
+}
+
+void ProfilerComponent::update() {
+  const std::string summary = this->get_summary();
+  ESP_LOGD(TAG, "%s", summary.c_str());
+#ifdef USE_TEXT_SENSOR
+  if (this->summary_ != nullptr)
+    this->summary_->publish_state(summary);
+#endif
+}
+
+size_t ProfilerComponent::probe_(Component *component, bool scheduler, uint32_t name_hash) const {
+  const size_t mask = this->slots_.size() - 1;
+  uint32_t hash = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(component)) ^ name_hash ^ scheduler;
+  hash *= 2654435769UL;
+  hash ^= hash >> 16;
+  size_t index = hash & mask;
+  while (true) {
+    const ProfilerStats &stats = this->slots_[index];
+    if (stats.count == 0 ||
+        (stats.component == component && stats.scheduler == scheduler && stats.name_hash == name_hash))
+      return index;
+    index = (index + 1) & mask;
+  }
+}
+
+void ProfilerComponent::grow_() {
+  std::vector<ProfilerStats> old;
+  old.swap(this->slots_);
+  this->slots_.resize(old.empty() ? PROFILER_MIN_SLOTS : old.size() * 2);
+  for (const auto &stats : old) {
+    if (stats.count != 0)
+      this->slots_[this->probe_(stats.component, stats.scheduler, stats.name_hash)] = stats;
+  }
+}
+
+void ProfilerComponent::record(Component *component, bool scheduler, uint32_t name_hash, uint32_t duration_us) {
+  // keep the load factor below 3/4
+  if ((this->used_count_ + 1) * 4 > this->slots_.size() * 3)
+    this->grow_();
+  ProfilerStats &stats = this->slots_[this->probe_(component, scheduler, name_hash)];
+  if (stats.count == 0) {
+    stats.component = component;
+    const auto &components = App.get_components();
+    stats.component_index = std::find(components.begin(), components.end(), component) - components.begin();
+    stats.scheduler = scheduler;
+    stats.name_hash = name_hash;
+    this->used_count_++;
+  }
+  stats.count++;
+  stats.total_us += duration_us;
+  stats.max_us = std::max(stats.max_us, duration_us);
+  uint8_t bucket = 0;
+  while (bucket < PROFILER_HISTOGRAM_BUCKETS - 1 && duration_us > PROFILER_HISTOGRAM_BOUNDS[bucket])
+    bucket++;
+  stats.histogram[bucket]++;
+}
+
+void ProfilerComponent::reset() {
+  std::fill(this->slots_.begin(), this->slots_.end(), ProfilerStats{});
+  this->used_count_ = 0;
+  this->reset_at_ = millis();
+}
+
+std::vector<ProfilerStats> ProfilerComponent::get_stats() const {
+  std::vector<ProfilerStats> ret;
+  this->collect_stats_(ret);
+  return ret;
+}
+
+void ProfilerComponent::collect_stats_(std::vector<ProfilerStats> &ret) const {
+  ret.clear();
+  ret.reserve(this->used_count_);
+  for (const auto &stats : this->slots_) {
+    if (stats.count != 0)
+      ret.push_back(stats);
+  }
+  std::sort(ret.begin(), ret.end(), [](const ProfilerStats &a, const ProfilerStats &b) {
+    if (a.component_index != b.component_index)
+      return a.component_index < b.component_index;
+    // components that aren't registered with App share an index
+    if (a.component != b.component)
+      return a.component < b.component;
+    if (a.scheduler != b.scheduler)
+      return a.scheduler < b.scheduler;
+    return a.name_hash < b.name_hash;
+  });
+}
+
+uint32_t ProfilerComponent::get_elapsed() const { return millis() - this->reset_at_; }
+
+std::string ProfilerComponent::get_summary(size_t max_length) const {
+  struct Total {
+    Component *component;
+    uint64_t total_us;
+    uint32_t max_us;
+  };
+  std::vector<Total> totals;
+  for (const auto &stats : this->get_stats()) {
+    // the stats are sorted by component, so all entries of a component are adjacent
+    if (totals.empty() || totals.back().component != stats.component)
+      totals.push_back(Total{stats.component, 0, 0});
+    totals.back().total_us += stats.total_us;
+    totals.back().max_us = std::max(totals.back().max_us, stats.max_us);
+  }
+  std::sort(totals.begin(), totals.end(), [](const Total &a, const Total &b) { return a.total_us > b.total_us; });
+
+  const uint64_t elapsed_us = std::max<uint64_t>(uint64_t(this->get_elapsed()) * 1000, 1);
+  std::string ret;
+  for (const auto &total : totals) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "%s%s %.1f%% max %.1fms", ret.empty() ? "" : ", ", get_component_name(total.component),
+             total.total_us * 100.0f / elapsed_us, total.max_us / 1000.0f);
+    if (ret.size() + strlen(buf) > max_length)
+      break;
+    ret += buf;
+  }
+  return ret;
+}
+
+const char *ProfilerComponent::get_component_name(Component *component) {
+  return component == nullptr ? "<unknown>" : component->get_component_source();
+}
+
+ProfilerComponent *global_profiler = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace profiler
+}  // namespace esphome
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+#include "esphome/core/helpers.h"
+
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+
+namespace esphome {
+namespace profiler {
+
+/// Number of execution time histogram buckets, the last one is unbounded.
+static const uint8_t PROFILER_HISTOGRAM_BUCKETS = 6;
+/// Upper bounds (inclusive, in microseconds) of all but the last histogram bucket.
+extern const uint32_t PROFILER_HISTOGRAM_BOUNDS[PROFILER_HISTOGRAM_BUCKETS - 1];
+
+struct ProfilerStats {
+  Component *component;
+  /// Position of the component in App.get_components(), to tell apart components with the same source.
+  uint32_t component_index;
+  /// Whether these are the stats of a scheduler item of the component, otherwise they cover Component::loop().
+  bool scheduler;
+  /// FNV-1 hash of the scheduler item name, SCHEDULER_NO_NAME for unnamed items, 0 for loop() stats.
+  uint32_t name_hash;
+  uint32_t count;
+  uint64_t total_us;
+  uint32_t max_us;
+  uint32_t histogram[PROFILER_HISTOGRAM_BUCKETS];
+};
+
+/** Records how often and how long each component's loop() and scheduler items run.
+ *
+ * The measurements are taken by WarnIfComponentBlockingGuard, so all work the main loop does on behalf of a
+ * component is covered.
+ */
+class ProfilerComponent : public PollingComponent {
+ public:
+  ProfilerComponent();
+
+  void setup() override;
+  void dump_config() override;
+  void loop() override;
+  void update() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+#ifdef USE_TEXT_SENSOR
+  void set_summary_text_sensor(text_sensor::TextSensor *summary) { this->summary_ = summary; }
+#endif
+
+  /// Add a single execution of \p duration_us to the stats of the component, called from the main loop only.
+  void record(Component *component, bool scheduler, uint32_t name_hash, uint32_t duration_us);
+
+  /// Clear all stats.
+  void reset();
+
+  /// All stats, sorted by the position of the component in App.get_components() and name hash. Main loop only.
+  std::vector<ProfilerStats> get_stats() const;
+  /** Copy the stats as get_stats() returned them at most a second ago into \p stats.
+   *
+   * For readers on other tasks, like web server handlers: record() doesn't lock, so they must not read the live
+   * stats. The snapshot is taken by loop().
+   */
+  void copy_snapshot(std::vector<ProfilerStats> &stats);
+
+  /// Milliseconds since the stats were reset.
+  uint32_t get_elapsed() const;
+
+  /// Short human readable description of the components with the highest total execution time.
+  std::string get_summary(size_t max_length = 255) const;
+
+  static const char *get_component_name(Component *component);
+
+ protected:
+  /// Index of the slot of the stats for the key, or of the empty slot where they would be inserted.
+  size_t probe_(Component *component, bool scheduler, uint32_t name_hash) const;
+  void grow_();
+  /// Replace the contents of \p stats with the sorted stats.
+  void collect_stats_(std::vector<ProfilerStats> &stats) const;
+
+  /** Open-addressed hash table with linear probing, a slot is used once its count is non-zero.
+   *
+   * It is sized for all components in setup() and cleared in place by reset(), so record() only allocates for
+   * components with many distinct scheduler items.
+   */
+  std::vector<ProfilerStats> slots_;
+  size_t used_count_{0};
+  uint32_t reset_at_{0};
+  /// The stats for copy_snapshot(), guarded by snapshot_lock_.
+  std::vector<ProfilerStats> snapshot_;
+  /// The previous snapshot, reused by loop() for the next one.
+  std::vector<ProfilerStats> snapshot_next_;
+  Mutex snapshot_lock_;
+  uint32_t snapshot_at_{0};
+#ifdef USE_TEXT_SENSOR
+  text_sensor::TextSensor *summary_{nullptr};
+#endif
+};
+
+extern ProfilerComponent *global_profiler;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace profiler
+}  // namespace esphome
@@ -0,0 +1,27 @@
+from esphome.components import text_sensor
+import esphome.config_validation as cv
+import esphome.codegen as cg
+from esphome.const import ENTITY_CATEGORY_DIAGNOSTIC, ICON_TIMER
+
+from . import CONF_PROFILER_ID, ProfilerComponent
+
+DEPENDENCIES = ["profiler"]
+
+CONF_SUMMARY = "summary"
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(CONF_PROFILER_ID): cv.use_id(ProfilerComponent),
+        cv.Optional(CONF_SUMMARY): text_sensor.text_sensor_schema(
+            icon=ICON_TIMER,
+            entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+        ),
+    }
+)
+
+
+async def to_code(config):
+    profiler = await cg.get_variable(config[CONF_PROFILER_ID])
+
+    if CONF_SUMMARY in config:
+        sens = await text_sensor.new_text_sensor(config[CONF_SUMMARY])
+        cg.add(profiler.set_summary_text_sensor(sens))
@@ -3,55 +3,191 @@
 #include "prometheus_handler.h"
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
 namespace esphome {
 namespace prometheus {
 
-void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
-  AsyncResponseStream *stream = req->beginResponseStream("text/plain; version=0.0.4; charset=utf-8");
+static void append(std::string &out, const __FlashStringHelper *str) {
+  PGM_P p = reinterpret_cast<PGM_P>(str);
+  const size_t length = strlen_P(p);
+  const size_t pos = out.size();
+  out.resize(pos + length);
+  memcpy_P(&out[pos], p, length);
+}
+
+/// Append \p value like Print::print(float), with two decimals.
+static void append_float(std::string &out, float value) {
+  if (std::isnan(value)) {
+    out += "NaN";
+    return;
+  }
+  char buf[24];
+  snprintf(buf, sizeof(buf), "%.2f", value);
+  out += buf;
+}
+
+static void append_uint(std::string &out, uint32_t value) {
+  char buf[12];
+  snprintf(buf, sizeof(buf), "%" PRIu32, value);
+  out += buf;
+}
+
+/// Append \p value as the content of a quoted label value.
+static void append_label_value(std::string &out, const std::string &value) {
+  for (char c : value) {
+    if (c == '\\' || c == '"') {
+      out += '\\';
+      out += c;
+    } else if (c == '\n') {
+      out += "\\n";
+    } else {
+      out += c;
+    }
+  }
+}
 
+void PrometheusHandler::setup() {
+  // The labels only change with the configuration, so they're built once instead of on every scrape
 #ifdef USE_SENSOR
-  this->sensor_type_(stream);
   for (auto *obj : App.get_sensors())
-    this->sensor_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_BINARY_SENSOR
-  this->binary_sensor_type_(stream);
   for (auto *obj : App.get_binary_sensors())
-    this->binary_sensor_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_FAN
-  this->fan_type_(stream);
   for (auto *obj : App.get_fans())
-    this->fan_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_LIGHT
-  this->light_type_(stream);
   for (auto *obj : App.get_lights())
-    this->light_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_COVER
-  this->cover_type_(stream);
   for (auto *obj : App.get_covers())
-    this->cover_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_SWITCH
-  this->switch_type_(stream);
   for (auto *obj : App.get_switches())
-    this->switch_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
-
 #ifdef USE_LOCK
-  this->lock_type_(stream);
   for (auto *obj : App.get_locks())
-    this->lock_row_(stream, obj);
+    this->add_labels_(obj);
 #endif
 
-  req->send(stream);
+  this->base_->init();
+  this->base_->add_handler(this);
+}
+
+void PrometheusHandler::handleRequest(AsyncWebServerRequest *req) {
+  this->openmetrics_ = false;
+  AsyncWebHeader *accept = req->getHeader("Accept");
+  if (accept != nullptr && accept->value().indexOf("application/openmetrics-text") >= 0)
+    this->openmetrics_ = true;
+
+  if (!this->buffer_ || this->buffer_.use_count() > 1) {
+    // the previous scrape is still being sent
+    this->buffer_ = std::make_shared<std::string>();
+  }
+  this->buffer_->clear();
+  this->write_metrics_(this->parse_filter_(req));
+  if (this->openmetrics_)
+    append(*this->buffer_, F("# EOF\n"));
+
+  std::shared_ptr<std::string> buffer = this->buffer_;
+  AsyncWebServerResponse *response =
+      req->beginChunkedResponse(this->openmetrics_ ? F("application/openmetrics-text; version=1.0.0; charset=utf-8")
+                                                   : F("text/plain; version=0.0.4; charset=utf-8"),
+                                [buffer](uint8_t *data, size_t max_len, size_t index) -> size_t {
+                                  if (index >= buffer->size())
+                                    return 0;
+                                  const size_t length = std::min(max_len, buffer->size() - index);
+                                  memcpy(data, buffer->data() + index, length);
+                                  return length;
+                                });
+  req->send(response);
+}
+
+uint16_t PrometheusHandler::parse_filter_(AsyncWebServerRequest *req) {
+  static const struct {
+    const char *name;
+    uint16_t domain;
+  } DOMAINS[] = {
+      {"sensor", DOMAIN_SENSOR}, {"binary_sensor", DOMAIN_BINARY_SENSOR},
+      {"fan", DOMAIN_FAN},       {"light", DOMAIN_LIGHT},
+      {"cover", DOMAIN_COVER},   {"switch", DOMAIN_SWITCH},
+      {"lock", DOMAIN_LOCK},     {"profiler", DOMAIN_PROFILER},
+  };
+
+  bool filtered = false;
+  uint16_t domains = 0;
+  // filter may be given several times, each with a comma separated list
+  for (size_t i = 0; i < req->params(); i++) {
+    AsyncWebParameter *param = req->getParam(i);
+    if (param->name() != "filter")
+      continue;
+    filtered = true;
+    const char *start = param->value().c_str();
+    while (true) {
+      const char *end = strchr(start, ',');
+      const size_t length = end == nullptr ? strlen(start) : end - start;
+      for (const auto &it : DOMAINS) {
+        if (strlen(it.name) == length && strncmp(it.name, start, length) == 0)
+          domains |= it.domain;
+      }
+      if (end == nullptr)
+        break;
+      start = end + 1;
+    }
+  }
+  return filtered ? domains : DOMAIN_ALL;
+}
+
+void PrometheusHandler::write_metrics_(uint16_t domains) {
+#ifdef USE_SENSOR
+  if (domains & DOMAIN_SENSOR)
+    this->sensor_metrics_();
+#endif
+
+#ifdef USE_BINARY_SENSOR
+  if (domains & DOMAIN_BINARY_SENSOR)
+    this->binary_sensor_metrics_();
+#endif
+
+#ifdef USE_FAN
+  if (domains & DOMAIN_FAN)
+    this->fan_metrics_();
+#endif
+
+#ifdef USE_LIGHT
+  if (domains & DOMAIN_LIGHT)
+    this->light_metrics_();
+#endif
+
+#ifdef USE_COVER
+  if (domains & DOMAIN_COVER)
+    this->cover_metrics_();
+#endif
+
+#ifdef USE_SWITCH
+  if (domains & DOMAIN_SWITCH)
+    this->switch_metrics_();
+#endif
+
+#ifdef USE_LOCK
+  if (domains & DOMAIN_LOCK)
+    this->lock_metrics_();
+#endif
+
+#ifdef USE_PROFILER
+  if ((domains & DOMAIN_PROFILER) && profiler::global_profiler != nullptr)
+    this->profiler_metrics_();
+#endif
 }
 
 std::string PrometheusHandler::relabel_id_(EntityBase *obj) {
@@ -64,289 +200,306 @@ std::string PrometheusHandler::relabel_name_(EntityBase *obj) {
   return item == relabel_map_name_.end() ? obj->get_name() : item->second;
 }
 
-// Type-specific implementation
-#ifdef USE_SENSOR
-void PrometheusHandler::sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_sensor_failed GAUGE\n"));
+void PrometheusHandler::add_labels_(EntityBase *obj) {
+  if (!this->is_exported_(obj))
+    return;
+  std::string labels = "id=\"";
+  append_label_value(labels, this->relabel_id_(obj));
+  labels += "\",name=\"";
+  append_label_value(labels, this->relabel_name_(obj));
+  labels += '"';
+  this->labels_[obj] = std::move(labels);
+}
+
+void PrometheusHandler::type_(const __FlashStringHelper *name, const __FlashStringHelper *type) {
+  std::string &out = *this->buffer_;
+  append(out, F("# TYPE "));
+  append(out, name);
+  out += ' ';
+  append(out, type);
+  out += '\n';
 }
-void PrometheusHandler::sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
+
+void PrometheusHandler::row_(const __FlashStringHelper *metric, EntityBase *obj) {
+  std::string &out = *this->buffer_;
+  append(out, metric);
+  out += '{';
+  auto it = this->labels_.find(obj);
+  if (it != this->labels_.end()) {
+    out += it->second;
     return;
-  if (!std::isnan(obj->state)) {
-    // We have a valid value, output this value
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
-    // Data itself
-    stream->print(F("esphome_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",unit=\""));
-    stream->print(obj->get_unit_of_measurement().c_str());
-    stream->print(F("\"} "));
-    stream->print(value_accuracy_to_string(obj->state, obj->get_accuracy_decimals()).c_str());
-    stream->print('\n');
-  } else {
-    // Invalid state
-    stream->print(F("esphome_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+  }
+  // Exported since setup (set_internal() at runtime). This runs on the web server task, so the labels are written
+  // out instead of being added to labels_.
+  append(out, F("id=\""));
+  append_label_value(out, this->relabel_id_(obj));
+  append(out, F("\",name=\""));
+  append_label_value(out, this->relabel_name_(obj));
+  out += '"';
+}
+
+// Type-specific implementation
+#ifdef USE_SENSOR
+void PrometheusHandler::sensor_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_sensor_value"), F("gauge"));
+  for (auto *obj : App.get_sensors()) {
+    // Only valid values have a data point
+    if (!this->is_exported_(obj) || std::isnan(obj->state))
+      continue;
+    this->row_(F("esphome_sensor_value"), obj);
+    append(out, F(",unit=\""));
+    append_label_value(out, obj->get_unit_of_measurement());
+    append(out, F("\"} "));
+    out += value_accuracy_to_string(obj->state, obj->get_accuracy_decimals());
+    out += '\n';
+  }
+  this->type_(F("esphome_sensor_failed"), F("gauge"));
+  for (auto *obj : App.get_sensors()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_sensor_failed"), obj);
+    append(out, std::isnan(obj->state) ? F("} 1\n") : F("} 0\n"));
   }
 }
 #endif
 
 // Type-specific implementation
 #ifdef USE_BINARY_SENSOR
-void PrometheusHandler::binary_sensor_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_binary_sensor_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_binary_sensor_failed GAUGE\n"));
-}
-void PrometheusHandler::binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  if (obj->has_state()) {
-    // We have a valid value, output this value
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
-    // Data itself
-    stream->print(F("esphome_binary_sensor_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->state);
-    stream->print('\n');
-  } else {
-    // Invalid state
-    stream->print(F("esphome_binary_sensor_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+void PrometheusHandler::binary_sensor_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_binary_sensor_value"), F("gauge"));
+  for (auto *obj : App.get_binary_sensors()) {
+    if (!this->is_exported_(obj) || !obj->has_state())
+      continue;
+    this->row_(F("esphome_binary_sensor_value"), obj);
+    append(out, obj->state ? F("} 1\n") : F("} 0\n"));
+  }
+  this->type_(F("esphome_binary_sensor_failed"), F("gauge"));
+  for (auto *obj : App.get_binary_sensors()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_binary_sensor_failed"), obj);
+    append(out, obj->has_state() ? F("} 0\n") : F("} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_FAN
-void PrometheusHandler::fan_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_fan_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_failed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_speed GAUGE\n"));
-  stream->print(F("#TYPE esphome_fan_oscillation GAUGE\n"));
-}
-void PrometheusHandler::fan_row_(AsyncResponseStream *stream, fan::Fan *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_fan_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
-  // Data itself
-  stream->print(F("esphome_fan_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+void PrometheusHandler::fan_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_fan_value"), F("gauge"));
+  for (auto *obj : App.get_fans()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_fan_value"), obj);
+    append(out, obj->state ? F("} 1\n") : F("} 0\n"));
+  }
+  this->type_(F("esphome_fan_failed"), F("gauge"));
+  for (auto *obj : App.get_fans()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_fan_failed"), obj);
+    append(out, F("} 0\n"));
+  }
   // Speed if available
-  if (obj->get_traits().supports_speed()) {
-    stream->print(F("esphome_fan_speed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->speed);
-    stream->print('\n');
+  this->type_(F("esphome_fan_speed"), F("gauge"));
+  for (auto *obj : App.get_fans()) {
+    if (!this->is_exported_(obj) || !obj->get_traits().supports_speed())
+      continue;
+    this->row_(F("esphome_fan_speed"), obj);
+    append(out, F("} "));
+    append_uint(out, obj->speed);
+    out += '\n';
   }
   // Oscillation if available
-  if (obj->get_traits().supports_oscillation()) {
-    stream->print(F("esphome_fan_oscillation{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->oscillating);
-    stream->print('\n');
+  this->type_(F("esphome_fan_oscillation"), F("gauge"));
+  for (auto *obj : App.get_fans()) {
+    if (!this->is_exported_(obj) || !obj->get_traits().supports_oscillation())
+      continue;
+    this->row_(F("esphome_fan_oscillation"), obj);
+    append(out, obj->oscillating ? F("} 1\n") : F("} 0\n"));
   }
 }
 #endif
 
 #ifdef USE_LIGHT
-void PrometheusHandler::light_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_light_state GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_color GAUGE\n"));
-  stream->print(F("#TYPE esphome_light_effect_active GAUGE\n"));
-}
-void PrometheusHandler::light_row_(AsyncResponseStream *stream, light::LightState *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
+void PrometheusHandler::light_metrics_() {
+  std::string &out = *this->buffer_;
   // State
-  stream->print(F("esphome_light_state{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->remote_values.is_on());
-  stream->print(F("\n"));
+  this->type_(F("esphome_light_state"), F("gauge"));
+  for (auto *obj : App.get_lights()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_light_state"), obj);
+    append(out, obj->remote_values.is_on() ? F("} 1\n") : F("} 0\n"));
+  }
   // Brightness and RGBW
-  light::LightColorValues color = obj->current_values;
-  float brightness, r, g, b, w;
-  color.as_brightness(&brightness);
-  color.as_rgbw(&r, &g, &b, &w);
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"brightness\"} "));
-  stream->print(brightness);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"r\"} "));
-  stream->print(r);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"g\"} "));
-  stream->print(g);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"b\"} "));
-  stream->print(b);
-  stream->print(F("\n"));
-  stream->print(F("esphome_light_color{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\",channel=\"w\"} "));
-  stream->print(w);
-  stream->print(F("\n"));
+  this->type_(F("esphome_light_color"), F("gauge"));
+  for (auto *obj : App.get_lights()) {
+    if (!this->is_exported_(obj))
+      continue;
+    const light::LightColorValues &color = obj->current_values;
+    float channels[5];
+    color.as_brightness(&channels[0]);
+    color.as_rgbw(&channels[1], &channels[2], &channels[3], &channels[4]);
+    static const char *const CHANNELS[] = {"brightness", "r", "g", "b", "w"};
+    for (uint8_t i = 0; i < 5; i++) {
+      this->row_(F("esphome_light_color"), obj);
+      append(out, F(",channel=\""));
+      out += CHANNELS[i];
+      append(out, F("\"} "));
+      append_float(out, channels[i]);
+      out += '\n';
+    }
+  }
   // Effect
-  std::string effect = obj->get_effect_name();
-  if (effect == "None") {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\"None\"} 0\n"));
-  } else {
-    stream->print(F("esphome_light_effect_active{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\",effect=\""));
-    stream->print(effect.c_str());
-    stream->print(F("\"} 1\n"));
+  this->type_(F("esphome_light_effect_active"), F("gauge"));
+  for (auto *obj : App.get_lights()) {
+    if (!this->is_exported_(obj))
+      continue;
+    const std::string effect = obj->get_effect_name();
+    this->row_(F("esphome_light_effect_active"), obj);
+    append(out, F(",effect=\""));
+    append_label_value(out, effect);
+    append(out, effect == "None" ? F("\"} 0\n") : F("\"} 1\n"));
   }
 }
 #endif
 
 #ifdef USE_COVER
-void PrometheusHandler::cover_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_cover_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_cover_failed GAUGE\n"));
-}
-void PrometheusHandler::cover_row_(AsyncResponseStream *stream, cover::Cover *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  if (!std::isnan(obj->position)) {
-    // We have a valid value, output this value
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 0\n"));
-    // Data itself
-    stream->print(F("esphome_cover_value{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} "));
-    stream->print(obj->position);
-    stream->print('\n');
-    if (obj->get_traits().get_supports_tilt()) {
-      stream->print(F("esphome_cover_tilt{id=\""));
-      stream->print(relabel_id_(obj).c_str());
-      stream->print(F("\",name=\""));
-      stream->print(relabel_name_(obj).c_str());
-      stream->print(F("\"} "));
-      stream->print(obj->tilt);
-      stream->print('\n');
-    }
-  } else {
-    // Invalid state
-    stream->print(F("esphome_cover_failed{id=\""));
-    stream->print(relabel_id_(obj).c_str());
-    stream->print(F("\",name=\""));
-    stream->print(relabel_name_(obj).c_str());
-    stream->print(F("\"} 1\n"));
+void PrometheusHandler::cover_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_cover_value"), F("gauge"));
+  for (auto *obj : App.get_covers()) {
+    // Only valid positions have a data point
+    if (!this->is_exported_(obj) || std::isnan(obj->position))
+      continue;
+    this->row_(F("esphome_cover_value"), obj);
+    append(out, F("} "));
+    append_float(out, obj->position);
+    out += '\n';
+  }
+  this->type_(F("esphome_cover_tilt"), F("gauge"));
+  for (auto *obj : App.get_covers()) {
+    if (!this->is_exported_(obj) || std::isnan(obj->position) || !obj->get_traits().get_supports_tilt())
+      continue;
+    this->row_(F("esphome_cover_tilt"), obj);
+    append(out, F("} "));
+    append_float(out, obj->tilt);
+    out += '\n';
+  }
+  this->type_(F("esphome_cover_failed"), F("gauge"));
+  for (auto *obj : App.get_covers()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_cover_failed"), obj);
+    append(out, std::isnan(obj->position) ? F("} 1\n") : F("} 0\n"));
   }
 }
 #endif
 
 #ifdef USE_SWITCH
-void PrometheusHandler::switch_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_switch_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_switch_failed GAUGE\n"));
-}
-void PrometheusHandler::switch_row_(AsyncResponseStream *stream, switch_::Switch *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_switch_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
-  // Data itself
-  stream->print(F("esphome_switch_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+void PrometheusHandler::switch_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_switch_value"), F("gauge"));
+  for (auto *obj : App.get_switches()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_switch_value"), obj);
+    append(out, obj->state ? F("} 1\n") : F("} 0\n"));
+  }
+  this->type_(F("esphome_switch_failed"), F("gauge"));
+  for (auto *obj : App.get_switches()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_switch_failed"), obj);
+    append(out, F("} 0\n"));
+  }
 }
 #endif
 
 #ifdef USE_LOCK
-void PrometheusHandler::lock_type_(AsyncResponseStream *stream) {
-  stream->print(F("#TYPE esphome_lock_value GAUGE\n"));
-  stream->print(F("#TYPE esphome_lock_failed GAUGE\n"));
+void PrometheusHandler::lock_metrics_() {
+  std::string &out = *this->buffer_;
+  this->type_(F("esphome_lock_value"), F("gauge"));
+  for (auto *obj : App.get_locks()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_lock_value"), obj);
+    append(out, F("} "));
+    append_uint(out, obj->state);
+    out += '\n';
+  }
+  this->type_(F("esphome_lock_failed"), F("gauge"));
+  for (auto *obj : App.get_locks()) {
+    if (!this->is_exported_(obj))
+      continue;
+    this->row_(F("esphome_lock_failed"), obj);
+    append(out, F("} 0\n"));
+  }
 }
-void PrometheusHandler::lock_row_(AsyncResponseStream *stream, lock::Lock *obj) {
-  if (obj->is_internal() && !this->include_internal_)
-    return;
-  stream->print(F("esphome_lock_failed{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} 0\n"));
-  // Data itself
-  stream->print(F("esphome_lock_value{id=\""));
-  stream->print(relabel_id_(obj).c_str());
-  stream->print(F("\",name=\""));
-  stream->print(relabel_name_(obj).c_str());
-  stream->print(F("\"} "));
-  stream->print(obj->state);
-  stream->print('\n');
+#endif
+
+#ifdef USE_PROFILER
+void PrometheusHandler::profiler_labels_(char *labels, size_t size, const profiler::ProfilerStats &stats) {
+  if (stats.scheduler) {
+    snprintf(labels, size, "component=\"%s\",index=\"%" PRIu32 "\",kind=\"scheduler\",item=\"0x%08" PRIX32 "\"",
+             profiler::ProfilerComponent::get_component_name(stats.component), stats.component_index, stats.name_hash);
+  } else {
+    snprintf(labels, size, "component=\"%s\",index=\"%" PRIu32 "\",kind=\"loop\"",
+             profiler::ProfilerComponent::get_component_name(stats.component), stats.component_index);
+  }
+}
+
+void PrometheusHandler::profiler_metrics_() {
+  std::string &out = *this->buffer_;
+  char labels[128];
+  char value[24];
+  // The handler runs on the web server task, while the main loop records into the live stats
+  profiler::global_profiler->copy_snapshot(this->profiler_stats_);
+  this->type_(F("esphome_component_run_seconds"), F("histogram"));
+  for (const auto &stats : this->profiler_stats_) {
+    profiler_labels_(labels, sizeof(labels), stats);
+    // Histogram buckets are cumulative
+    uint32_t count = 0;
+    for (uint8_t i = 0; i < profiler::PROFILER_HISTOGRAM_BUCKETS; i++) {
+      count += stats.histogram[i];
+      append(out, F("esphome_component_run_seconds_bucket{"));
+      out += labels;
+      append(out, F(",le=\""));
+      if (i < profiler::PROFILER_HISTOGRAM_BUCKETS - 1) {
+        snprintf(value, sizeof(value), "%g", profiler::PROFILER_HISTOGRAM_BOUNDS[i] / 1e6);
+        out += value;
+      } else {
+        append(out, F("+Inf"));
+      }
+      append(out, F("\"} "));
+      append_uint(out, count);
+      out += '\n';
+    }
+    append(out, F("esphome_component_run_seconds_sum{"));
+    out += labels;
+    append(out, F("} "));
+    snprintf(value, sizeof(value), "%.6f", stats.total_us / 1e6);
+    out += value;
+    out += '\n';
+    append(out, F("esphome_component_run_seconds_count{"));
+    out += labels;
+    append(out, F("} "));
+    append_uint(out, stats.count);
+    out += '\n';
+  }
+  this->type_(F("esphome_component_run_max_seconds"), F("gauge"));
+  for (const auto &stats : this->profiler_stats_) {
+    profiler_labels_(labels, sizeof(labels), stats);
+    append(out, F("esphome_component_run_max_seconds{"));
+    out += labels;
+    append(out, F("} "));
+    snprintf(value, sizeof(value), "%.6f", stats.max_us / 1e6);
+    out += value;
+    out += '\n';
+  }
 }
 #endif
 
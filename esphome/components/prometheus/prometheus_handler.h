@@ -3,6 +3,8 @@
 #ifdef USE_ARDUINO
 
 #include <map>
+#include <memory>
+#include <string>
 #include <utility>
 
 #include "esphome/core/entity_base.h"
@@ -10,6 +12,10 @@
 #include "esphome/core/controller.h"
 #include "esphome/core/component.h"
 
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
+
 namespace esphome {
 namespace prometheus {
 
@@ -40,81 +46,122 @@ class PrometheusHandler : public AsyncWebHandler, public Component {
 
   bool canHandle(AsyncWebServerRequest *request) override {
     if (request->method() == HTTP_GET) {
-      if (request->url() == "/metrics")
+      if (request->url() == "/metrics") {
+        // for the OpenMetrics content negotiation
+        request->addInterestingHeader("Accept");
         return true;
+      }
     }
 
     return false;
   }
 
+  /** Serve the metrics.
+   *
+   * The exposition is rendered into a buffer that is kept between scrapes and sent as a chunked response. Clients
+   * accepting `application/openmetrics-text` get the OpenMetrics format, terminated by `# EOF`. The `filter` query
+   * parameter limits the output to the given comma separated domains, for example `?filter=sensor,binary_sensor`.
+   */
   void handleRequest(AsyncWebServerRequest *req) override;
 
-  void setup() override {
-    this->base_->init();
-    this->base_->add_handler(this);
-  }
+  void setup() override;
   float get_setup_priority() const override {
     // After WiFi
     return setup_priority::WIFI - 1.0f;
   }
 
  protected:
+  /// Metric domains, for the `filter` query parameter.
+  enum Domain : uint16_t {
+    DOMAIN_SENSOR = 1 << 0,
+    DOMAIN_BINARY_SENSOR = 1 << 1,
+    DOMAIN_FAN = 1 << 2,
+    DOMAIN_LIGHT = 1 << 3,
+    DOMAIN_COVER = 1 << 4,
+    DOMAIN_SWITCH = 1 << 5,
+    DOMAIN_LOCK = 1 << 6,
+    DOMAIN_PROFILER = 1 << 7,
+    DOMAIN_ALL = 0xFFFF,
+  };
+
   std::string relabel_id_(EntityBase *obj);
   std::string relabel_name_(EntityBase *obj);
+  /// Build the cached `id="...",name="..."` labels of \p obj.
+  void add_labels_(EntityBase *obj);
+  /// The domains selected by the `filter` query parameters of \p req, all of them if there are none.
+  uint16_t parse_filter_(AsyncWebServerRequest *req);
+  /// Write the exposition of the \p domains into buffer_.
+  void write_metrics_(uint16_t domains);
+  /// Whether \p obj is exported, and has cached labels.
+  bool is_exported_(EntityBase *obj) const { return !obj->is_internal() || this->include_internal_; }
+  /// Write the TYPE line of a metric family, whose data points must all follow before the next family.
+  void type_(const __FlashStringHelper *name, const __FlashStringHelper *type);
+  /// Start a data point of \p obj up to its cached labels, the caller adds any further labels, "} " and the value.
+  void row_(const __FlashStringHelper *metric, EntityBase *obj);
 
 #ifdef USE_SENSOR
-  /// Return the type for prometheus
-  void sensor_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void sensor_row_(AsyncResponseStream *stream, sensor::Sensor *obj);
+  /// Write the sensor metric families
+  void sensor_metrics_();
 #endif
 
 #ifdef USE_BINARY_SENSOR
-  /// Return the type for prometheus
-  void binary_sensor_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void binary_sensor_row_(AsyncResponseStream *stream, binary_sensor::BinarySensor *obj);
+  /// Write the binary sensor metric families
+  void binary_sensor_metrics_();
 #endif
 
 #ifdef USE_FAN
-  /// Return the type for prometheus
-  void fan_type_(AsyncResponseStream *stream);
-  /// Return the sensor state as prometheus data point
-  void fan_row_(AsyncResponseStream *stream, fan::Fan *obj);
+  /// Write the fan metric families
+  void fan_metrics_();
 #endif
 
 #ifdef USE_LIGHT
-  /// Return the type for prometheus
-  void light_type_(AsyncResponseStream *stream);
-  /// Return the Light Values state as prometheus data point
-  void light_row_(AsyncResponseStream *stream, light::LightState *obj);
+  /// Write the light metric families
+  void light_metrics_();
 #endif
 
 #ifdef USE_COVER
-  /// Return the type for prometheus
-  void cover_type_(AsyncResponseStream *stream);
-  /// Return the switch Values state as prometheus data point
-  void cover_row_(AsyncResponseStream *stream, cover::Cover *obj);
+  /// Write the cover metric families
+  void cover_metrics_();
 #endif
 
 #ifdef USE_SWITCH
-  /// Return the type for prometheus
-  void switch_type_(AsyncResponseStream *stream);
-  /// Return the switch Values state as prometheus data point
-  void switch_row_(AsyncResponseStream *stream, switch_::Switch *obj);
+  /// Write the switch metric families
+  void switch_metrics_();
 #endif
 
 #ifdef USE_LOCK
-  /// Return the type for prometheus
-  void lock_type_(AsyncResponseStream *stream);
-  /// Return the lock Values state as prometheus data point
-  void lock_row_(AsyncResponseStream *stream, lock::Lock *obj);
+  /// Write the lock metric families
+  void lock_metrics_();
+#endif
+
+#ifdef USE_PROFILER
+  /// Write the execution time histograms of the components' loop() and scheduler items
+  void profiler_metrics_();
+  /// The `component`, `index`, `kind` and `item` labels of \p stats.
+  static void profiler_labels_(char *labels, size_t size, const profiler::ProfilerStats &stats);
 #endif
 
   web_server_base::WebServerBase *base_;
   bool include_internal_{false};
   std::map<EntityBase *, std::string> relabel_map_id_;
   std::map<EntityBase *, std::string> relabel_map_name_;
+  /** The `id` and `name` labels of each exported entity.
+   *
+   * Built in setup() and only read afterwards, as requests are handled on the web server task.
+   */
+  std::map<EntityBase *, std::string> labels_;
+  /** The exposition being written, kept between scrapes so it doesn't have to grow again.
+   *
+   * Shared with the chunked response sending it; a scrape arriving while the previous one is still being sent gets a
+   * new buffer.
+   */
+  std::shared_ptr<std::string> buffer_;
+  /// Whether the exposition being written uses the OpenMetrics format.
+  bool openmetrics_{false};
+#ifdef USE_PROFILER
+  /// Snapshot of the profiler stats being written, kept between scrapes.
+  std::vector<profiler::ProfilerStats> profiler_stats_;
+#endif
 };
 
 }  // namespace prometheus
@@ -1,3 +1,4 @@
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -40,13 +41,17 @@ class RemoteTransmitData {
   uint32_t carrier_frequency_{0};
 };
 
+class RemoteDecodeCache;
+
 class RemoteReceiveData {
  public:
-  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance)
-      : data_(data), index_(0), tolerance_(tolerance) {}
+  explicit RemoteReceiveData(const RawTimings &data, uint8_t tolerance, RemoteDecodeCache *cache = nullptr)
+      : data_(data), index_(0), tolerance_(tolerance), cache_(cache) {}
 
   const RawTimings &get_raw_data() const { return this->data_; }
   uint32_t get_index() const { return index_; }
+  /// The decode results of the receiver this data is from, for decode_cached(). nullptr if it isn't from a receiver.
+  RemoteDecodeCache *get_cache() const { return this->cache_; }
   int32_t operator[](uint32_t index) const { return this->data_[index]; }
   int32_t size() const { return this->data_.size(); }
   bool is_valid(uint32_t offset) const { return this->index_ + offset < this->data_.size(); }
@@ -72,6 +77,61 @@ class RemoteReceiveData {
   const RawTimings &data_;
   uint32_t index_;
   uint8_t tolerance_;
+  RemoteDecodeCache *cache_;
+};
+
+/** The results of decode_cached() for the frame a receiver passes to its listeners and dumpers.
+ *
+ * Owned by the receiver, so one receiver's results are never returned for another's frame. Each protocol that decoded
+ * a frame of the receiver has an entry, allocated once and reused for the following frames.
+ */
+class RemoteDecodeCache {
+ public:
+  /// Forget the results of the previous frame.
+  void next_frame() {
+    for (auto &entry : this->entries_)
+      entry->valid = false;
+  }
+
+  /// The result of protocol \p T for the current frame, decoding \p src if no listener or dumper has yet.
+  template<typename T> auto decode(RemoteReceiveData src) {
+    auto *entry = this->entry_<T, decltype(T().decode(src))>();
+    if (!entry->valid) {
+      entry->result = T().decode(src);
+      entry->valid = true;
+    }
+    return entry->result;
+  }
+
+ protected:
+  struct EntryBase {
+    virtual ~EntryBase() = default;
+    const void *protocol{nullptr};
+    bool valid{false};
+  };
+  template<typename R> struct Entry : EntryBase {
+    R result;
+  };
+
+  /// An address unique to each protocol, identifying its entry.
+  template<typename T> static const void *protocol_key_() {
+    static const char KEY = 0;
+    return &KEY;
+  }
+  /// The entry of protocol \p T, whose decode() returns \p R.
+  template<typename T, typename R> Entry<R> *entry_() {
+    const void *key = protocol_key_<T>();
+    for (auto &entry : this->entries_) {
+      if (entry->protocol == key)
+        return static_cast<Entry<R> *>(entry.get());
+    }
+    auto entry = make_unique<Entry<R>>();
+    entry->protocol = key;
+    this->entries_.push_back(std::move(entry));
+    return static_cast<Entry<R> *>(this->entries_.back().get());
+  }
+
+  std::vector<std::unique_ptr<EntryBase>> entries_;
 };
 
 class RemoteComponentBase {
@@ -158,16 +218,16 @@ class RemoteReceiverBase : public RemoteComponentBase {
  protected:
   void call_listeners_();
   void call_dumpers_();
-  void call_listeners_dumpers_() {
-    this->call_listeners_();
-    this->call_dumpers_();
-  }
+  /// Pass the frame in temp_ to all listeners and dumpers.
+  void call_listeners_dumpers_();
 
   std::vector<RemoteReceiverListener *> listeners_;
   std::vector<RemoteReceiverDumperBase *> dumpers_;
   std::vector<RemoteReceiverDumperBase *> secondary_dumpers_;
   RawTimings temp_;
   uint8_t tolerance_;
+  /// decode_cached() results for the frame in temp_.
+  RemoteDecodeCache decode_cache_;
 };
 
 class RemoteReceiverBinarySensorBase : public binary_sensor::BinarySensorInitiallyOff,
@@ -189,14 +249,25 @@ template<typename T> class RemoteProtocol {
   virtual void dump(const T &data) = 0;
 };
 
+/** Decode \p src with protocol \p T, at most once per received frame.
+ *
+ * A receiver passes the same frame to every listener and dumper, so the first one of a protocol decodes it and all
+ * the others share the result from the receiver's RemoteDecodeCache, whether the frame matched or not. Data that isn't
+ * from a receiver is always decoded.
+ */
+template<typename T> auto decode_cached(RemoteReceiveData src) {
+  if (src.get_cache() == nullptr || src.get_index() != 0)
+    return T().decode(src);
+  return src.get_cache()->decode<T>(src);
+}
+
 template<typename T, typename D> class RemoteReceiverBinarySensor : public RemoteReceiverBinarySensorBase {
  public:
   RemoteReceiverBinarySensor() : RemoteReceiverBinarySensorBase() {}
 
  protected:
   bool matches(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_cached<T>(src);
     return res.has_value() && *res == this->data_;
   }
 
@@ -210,8 +281,7 @@ template<typename T, typename D> class RemoteReceiverBinarySensor : public Remot
 template<typename T, typename D> class RemoteReceiverTrigger : public Trigger<D>, public RemoteReceiverListener {
  protected:
   bool on_receive(RemoteReceiveData src) override {
-    auto proto = T();
-    auto res = proto.decode(src);
+    auto res = decode_cached<T>(src);
     if (res.has_value()) {
       this->trigger(*res);
       return true;
@@ -244,11 +314,10 @@ template<typename... Ts> class RemoteTransmitterActionBase : public Action<Ts...
 template<typename T, typename D> class RemoteReceiverDumper : public RemoteReceiverDumperBase {
  public:
   bool dump(RemoteReceiveData src) override {
-    auto proto = T();
-    auto decoded = proto.decode(src);
+    auto decoded = decode_cached<T>(src);
     if (!decoded.has_value())
       return false;
-    proto.dump(*decoded);
+    T().dump(*decoded);
     return true;
   }
 };
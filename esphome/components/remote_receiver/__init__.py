@@ -21,6 +21,16 @@ RemoteReceiverComponent = remote_receiver_ns.class_(
 )
 
 MULTI_CONF = True
+
+
+def validate_idle(value):
+    # The ESP8266 and LibreTiny receivers store edge deltas as 16 bit microseconds,
+    # a saturated delta always ends the frame
+    if not CORE.is_esp32 and value > TimePeriod(microseconds=65535):
+        raise cv.Invalid(f"idle can be at most 65535us on {CORE.target_platform}")
+    return value
+
+
 CONFIG_SCHEMA = remote_base.validate_triggers(
     cv.Schema(
         {
@@ -41,9 +51,9 @@ CONFIG_SCHEMA = remote_base.validate_triggers(
                 cv.positive_time_period_microseconds,
                 cv.Range(max=TimePeriod(microseconds=255)),
             ),
-            cv.Optional(
-                CONF_IDLE, default="10ms"
-            ): cv.positive_time_period_microseconds,
+            cv.Optional(CONF_IDLE, default="10ms"): cv.All(
+                cv.positive_time_period_microseconds, validate_idle
+            ),
             cv.Optional(CONF_MEMORY_BLOCKS, default=3): cv.Range(min=1, max=8),
         }
     ).extend(cv.COMPONENT_SCHEMA)
@@ -10,18 +10,25 @@ namespace remote_receiver {
 struct RemoteReceiverComponentStore {
   static void gpio_intr(RemoteReceiverComponentStore *arg);
 
-  /// Stores the time (in micros) that the leading/falling edge happened at
-  ///  * An even index means a falling edge appeared at the time stored at the index
-  ///  * An uneven index means a rising edge appeared at the time stored at the index
-  volatile uint32_t *buffer{nullptr};
+  /// Stored instead of the time since the previous edge when that doesn't fit in 16 bits, always ends a frame.
+  static const uint16_t LONG_GAP = UINT16_MAX;
+
+  /// Stores the time (in micros) since the previous edge, capped at LONG_GAP
+  ///  * An even index means a falling edge appeared after the time stored at the index
+  ///  * An uneven index means a rising edge appeared after the time stored at the index
+  volatile uint16_t *buffer{nullptr};
   /// The position last written to
   volatile uint32_t buffer_write_at;
   /// The position last read from
   uint32_t buffer_read_at{0};
+  /// The time (in micros) of the last edge
+  volatile uint32_t last_change{0};
   bool overflow{false};
   uint32_t buffer_size{1000};
   uint8_t filter_us{10};
   ISRInternalGPIOPin pin;
+  /// Woken up on every edge, for the tickless main loop
+  Component *component{nullptr};
 };
 #endif
 
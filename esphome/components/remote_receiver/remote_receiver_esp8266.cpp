@@ -22,12 +22,15 @@ void IRAM_ATTR HOT RemoteReceiverComponentStore::gpio_intr(RemoteReceiverCompone
   if (next == arg->buffer_read_at)
     return;
 
-  const uint32_t last_change = arg->buffer[arg->buffer_write_at];
-  const uint32_t time_since_change = now - last_change;
+  const uint32_t time_since_change = now - arg->last_change;
   if (time_since_change <= arg->filter_us)
     return;
 
-  arg->buffer[arg->buffer_write_at = next] = now;
+  arg->buffer[arg->buffer_write_at = next] =
+      time_since_change < RemoteReceiverComponentStore::LONG_GAP ? time_since_change
+                                                                 : RemoteReceiverComponentStore::LONG_GAP;
+  arg->last_change = now;
+  arg->component->wake();
 }
 
 void RemoteReceiverComponent::setup() {
@@ -37,16 +40,19 @@ void RemoteReceiverComponent::setup() {
   s.filter_us = this->filter_us_;
   s.pin = this->pin_->to_isr();
   s.buffer_size = this->buffer_size_;
+  s.component = this;
 
+#ifndef USE_TICKLESS_LOOP
   this->high_freq_.start();
+#endif
   if (s.buffer_size % 2 != 0) {
     // Make sure divisible by two. This way, we know that every 0bxxx0 index is a space and every 0bxxx1 index is a mark
     s.buffer_size++;
   }
 
-  s.buffer = new uint32_t[s.buffer_size];
+  s.buffer = new uint16_t[s.buffer_size];
   void *buf = (void *) s.buffer;
-  memset(buf, 0, s.buffer_size * sizeof(uint32_t));
+  memset(buf, 0, s.buffer_size * sizeof(uint16_t));
 
   // First index is a space.
   if (this->pin_->digital_read()) {
@@ -76,41 +82,46 @@ void RemoteReceiverComponent::loop() {
   const uint32_t write_at = s.buffer_write_at;
   const uint32_t dist = (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
   // signals must at least one rising and one leading edge
-  if (dist <= 1)
+  if (dist <= 1) {
+#ifdef USE_TICKLESS_LOOP
+    // sleep until the next edge interrupt
+    this->high_freq_.stop();
+    this->idle();
+#endif
     return;
+  }
+#ifdef USE_TICKLESS_LOOP
+  // a signal is being received, poll for its end with full resolution
+  this->high_freq_.start();
+#endif
   const uint32_t now = micros();
-  if (now - s.buffer[write_at] < this->idle_us_) {
+  if (now - s.last_change < this->idle_us_) {
     // The last change was fewer than the configured idle time ago.
     return;
   }
 
   ESP_LOGVV(TAG, "read_at=%u write_at=%u dist=%u now=%u end=%u", s.buffer_read_at, write_at, dist, now,
-            s.buffer[write_at]);
+            s.last_change);
 
-  // Skip first value, it's from the previous idle level
-  s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
-  uint32_t prev = s.buffer_read_at;
+  // Skip first value, it's the time spent at the previous idle level
   s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
-  const uint32_t reserve_size = 1 + (s.buffer_size + write_at - s.buffer_read_at) % s.buffer_size;
+  // temp_ keeps its capacity between frames, so this only allocates when a frame is longer than any before it
   this->temp_.clear();
-  this->temp_.reserve(reserve_size);
-  int32_t multiplier = s.buffer_read_at % 2 == 0 ? 1 : -1;
+  int32_t multiplier = s.buffer_read_at % 2 == 0 ? -1 : 1;
 
-  for (uint32_t i = 0; prev != write_at; i++) {
-    int32_t delta = s.buffer[s.buffer_read_at] - s.buffer[prev];
-    if (uint32_t(delta) >= this->idle_us_) {
+  while (s.buffer_read_at != write_at) {
+    const uint32_t next = (s.buffer_read_at + 1) % s.buffer_size;
+    const uint32_t delta = s.buffer[next];
+    if (delta >= this->idle_us_ || delta == RemoteReceiverComponentStore::LONG_GAP) {
       // already found a space longer than idle. There must have been two pulses
       break;
     }
 
-    ESP_LOGVV(TAG, "  i=%u buffer[%u]=%u - buffer[%u]=%u -> %d", i, s.buffer_read_at, s.buffer[s.buffer_read_at], prev,
-              s.buffer[prev], multiplier * delta);
-    this->temp_.push_back(multiplier * delta);
-    prev = s.buffer_read_at;
-    s.buffer_read_at = (s.buffer_read_at + 1) % s.buffer_size;
+    ESP_LOGVV(TAG, "  buffer[%u]=%u -> %d", next, delta, multiplier * int32_t(delta));
+    this->temp_.push_back(multiplier * int32_t(delta));
+    s.buffer_read_at = next;
     multiplier *= -1;
   }
-  s.buffer_read_at = (s.buffer_size + s.buffer_read_at - 1) % s.buffer_size;
   this->temp_.push_back(this->idle_us_ * multiplier);
 
   this->call_listeners_dumpers_();
@@ -12,6 +12,7 @@
 
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
+#include "esphome/core/preference_cache.h"
 #include "esphome/core/preferences.h"
 
 namespace esphome {
@@ -23,6 +24,10 @@ static bool s_prevent_write = false;        // NOLINT(cppcoreguidelines-avoid-no
 static uint8_t *s_flash_storage = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 static bool s_flash_dirty = false;          // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
+/// CRC-32 of the flash sector contents, to drop saves that restored the previous value.
+static uint32_t s_flash_crc = 0;              // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+static PreferenceWriteBudget s_write_budget;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
 static const uint32_t RP2040_FLASH_STORAGE_SIZE = 512;
 
 extern "C" uint8_t _EEPROM_start;
@@ -89,6 +94,7 @@ class RP2040Preferences : public ESPPreferences {
     s_flash_storage = new uint8_t[RP2040_FLASH_STORAGE_SIZE];  // NOLINT
     ESP_LOGVV(TAG, "Loading preferences from flash...");
     memcpy(s_flash_storage, this->eeprom_sector_, RP2040_FLASH_STORAGE_SIZE);
+    s_flash_crc = crc32(s_flash_storage, RP2040_FLASH_STORAGE_SIZE);
   }
 
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash) override {
@@ -108,12 +114,27 @@ class RP2040Preferences : public ESPPreferences {
     return {pref};
   }
 
-  bool sync() override {
+  bool sync() override { return this->sync_(false); }
+  bool sync_within_budget() override { return this->sync_(true); }
+  void set_write_budget(uint32_t max_writes, uint32_t window_ms) override { s_write_budget.set(max_writes, window_ms); }
+
+  bool sync_(bool use_budget) {
     if (!s_flash_dirty)
       return true;
     if (s_prevent_write)
       return false;
 
+    const uint32_t crc = crc32(s_flash_storage, RP2040_FLASH_STORAGE_SIZE);
+    if (crc == s_flash_crc) {
+      ESP_LOGV(TAG, "Preferences not changed, skipping flash write");
+      s_flash_dirty = false;
+      return true;
+    }
+    if (use_budget && !s_write_budget.consume()) {
+      ESP_LOGW(TAG, "Flash write budget exhausted, deferring preferences save");
+      return true;
+    }
+
     ESP_LOGD(TAG, "Saving preferences to flash...");
 
     {
@@ -125,6 +146,7 @@ class RP2040Preferences : public ESPPreferences {
     }
 
     s_flash_dirty = false;
+    s_flash_crc = crc;
     return true;
   }
 
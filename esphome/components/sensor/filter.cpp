@@ -2,6 +2,7 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "sensor.h"
+#include <algorithm>
 #include <cmath>
 
 namespace esphome {
@@ -31,6 +32,21 @@ void Filter::initialize(Sensor *parent, Filter *next) {
   this->next_ = next;
 }
 
+// The median and quantile filters keep the non-NaN values of their window sorted, so that every value only needs a
+// binary search and a move of the larger values instead of a copy and sort of the whole window.
+static void insert_sorted(std::vector<float> &sorted, float value) {
+  if (std::isnan(value))
+    return;
+  sorted.insert(std::upper_bound(sorted.begin(), sorted.end(), value), value);
+}
+static void erase_sorted(std::vector<float> &sorted, float value) {
+  if (std::isnan(value))
+    return;
+  auto it = std::lower_bound(sorted.begin(), sorted.end(), value);
+  if (it != sorted.end() && *it == value)
+    sorted.erase(it);
+}
+
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
     : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
@@ -38,33 +54,23 @@ void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_
 void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MedianFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    erase_sorted(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  insert_sorted(this->sorted_, value);
   ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float median = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> median_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          median_queue.push_back(v);
-        }
-      }
-
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size) {
-        if (queue_size % 2) {
-          median = median_queue[queue_size / 2];
-        } else {
-          median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-        }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      if (queue_size % 2) {
+        median = this->sorted_[queue_size / 2];
+      } else {
+        median = (this->sorted_[queue_size / 2] + this->sorted_[(queue_size / 2) - 1]) / 2.0f;
       }
     }
 
@@ -95,32 +101,22 @@ void QuantileFilter::set_window_size(size_t window_size) { this->window_size_ =
 void QuantileFilter::set_quantile(float quantile) { this->quantile_ = quantile; }
 optional<float> QuantileFilter::new_value(float value) {
   while (this->queue_.size() >= this->window_size_) {
+    erase_sorted(this->sorted_, this->queue_.front());
     this->queue_.pop_front();
   }
   this->queue_.push_back(value);
+  insert_sorted(this->sorted_, value);
   ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f), quantile:%f", this, value, this->quantile_);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
     float result = NAN;
-    if (!this->queue_.empty()) {
-      // Copy queue without NaN values
-      std::vector<float> quantile_queue;
-      for (auto v : this->queue_) {
-        if (!std::isnan(v)) {
-          quantile_queue.push_back(v);
-        }
-      }
-
-      sort(quantile_queue.begin(), quantile_queue.end());
-
-      size_t queue_size = quantile_queue.size();
-      if (queue_size) {
-        size_t position = ceilf(queue_size * this->quantile_) - 1;
-        ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
-        result = quantile_queue[position];
-      }
+    size_t queue_size = this->sorted_.size();
+    if (queue_size) {
+      size_t position = ceilf(queue_size * this->quantile_) - 1;
+      ESP_LOGVV(TAG, "QuantileFilter(%p)::position: %d/%d", this, position + 1, queue_size);
+      result = this->sorted_[position];
     }
 
     ESP_LOGVV(TAG, "QuantileFilter(%p)::new_value(%f) SENDING %f", this, value, result);
@@ -135,21 +131,22 @@ MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MinFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
+  const uint32_t index = this->count_++;
+  while (!this->queue_.empty() && index - this->queue_.front().first >= this->window_size_) {
     this->queue_.pop_front();
   }
-  this->queue_.push_back(value);
+  if (!std::isnan(value)) {
+    while (!this->queue_.empty() && this->queue_.back().second >= value) {
+      this->queue_.pop_back();
+    }
+    this->queue_.emplace_back(index, value);
+  }
   ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float min = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        min = std::isnan(min) ? v : std::min(min, v);
-      }
-    }
+    float min = this->queue_.empty() ? NAN : this->queue_.front().second;
 
     ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING %f", this, value, min);
     return min;
@@ -163,21 +160,22 @@ MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at
 void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
 optional<float> MaxFilter::new_value(float value) {
-  while (this->queue_.size() >= this->window_size_) {
+  const uint32_t index = this->count_++;
+  while (!this->queue_.empty() && index - this->queue_.front().first >= this->window_size_) {
     this->queue_.pop_front();
   }
-  this->queue_.push_back(value);
+  if (!std::isnan(value)) {
+    while (!this->queue_.empty() && this->queue_.back().second <= value) {
+      this->queue_.pop_back();
+    }
+    this->queue_.emplace_back(index, value);
+  }
   ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = NAN;
-    for (auto v : this->queue_) {
-      if (!std::isnan(v)) {
-        max = std::isnan(max) ? v : std::max(max, v);
-      }
-    }
+    float max = this->queue_.empty() ? NAN : this->queue_.front().second;
 
     ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING %f", this, value, max);
     return max;
@@ -67,7 +67,10 @@ class QuantileFilter : public Filter {
   void set_quantile(float quantile);
 
  protected:
+  /// The values in the window, in the order they were received.
   std::deque<float> queue_;
+  /// The non-NaN values in the window, sorted.
+  std::vector<float> sorted_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -96,7 +99,10 @@ class MedianFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
+  /// The values in the window, in the order they were received.
   std::deque<float> queue_;
+  /// The non-NaN values in the window, sorted.
+  std::vector<float> sorted_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -142,7 +148,14 @@ class MinFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /** The candidates for the min of the window with their sequence numbers, oldest first.
+   *
+   * A value that is greater than or equal to a newer value can never be the result again, so it is dropped when the
+   * newer value is inserted. This keeps the result at the front.
+   */
+  std::deque<std::pair<uint32_t, float>> queue_;
+  /// Sequence number of the next value.
+  uint32_t count_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
@@ -170,7 +183,14 @@ class MaxFilter : public Filter {
   void set_window_size(size_t window_size);
 
  protected:
-  std::deque<float> queue_;
+  /** The candidates for the max of the window with their sequence numbers, oldest first.
+   *
+   * A value that is less than or equal to a newer value can never be the result again, so it is dropped when the
+   * newer value is inserted. This keeps the result at the front.
+   */
+  std::deque<std::pair<uint32_t, float>> queue_;
+  /// Sequence number of the next value.
+  uint32_t count_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
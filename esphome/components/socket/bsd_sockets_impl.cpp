@@ -1,6 +1,7 @@
 #include "socket.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/helpers.h"
+#include "esphome/core/application.h"
 
 #ifdef USE_SOCKET_IMPL_BSD_SOCKETS
 
@@ -54,6 +55,12 @@ class BSDSocketImpl : public Socket {
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return ::bind(fd_, addr, addrlen); }
   int close() override {
+#ifdef USE_TICKLESS_LOOP
+    if (wake_registered_) {
+      App.unregister_wake_socket(fd_);
+      wake_registered_ = false;
+    }
+#endif
     int ret = ::close(fd_);
     closed_ = true;
     return ret;
@@ -118,9 +125,19 @@ class BSDSocketImpl : public Socket {
     return 0;
   }
 
+#ifdef USE_TICKLESS_LOOP
+  void set_wake_component(Component *component) override {
+    App.register_wake_socket(fd_, component);
+    wake_registered_ = true;
+  }
+#endif
+
  protected:
   int fd_;
   bool closed_ = false;
+#ifdef USE_TICKLESS_LOOP
+  bool wake_registered_ = false;
+#endif
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
@@ -11,6 +11,7 @@
 #include <cstring>
 #include <queue>
 
+#include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
@@ -496,6 +497,7 @@ class LWIPRawImpl : public Socket {
     auto sock = make_unique<LWIPRawImpl>(family_, newpcb);
     sock->init();
     accepted_sockets_.push(std::move(sock));
+    this->wake_();
     return ERR_OK;
   }
   void err_fn(err_t err) {
@@ -506,6 +508,7 @@ class LWIPRawImpl : public Socket {
     // ERR_RST: connection was reset by remote host
     // ERR_ABRT: aborted through tcp_abort or TCP timer
     pcb_ = nullptr;
+    this->wake_();
   }
   err_t recv_fn(struct pbuf *pb, err_t err) {
     LWIP_LOG("recv(pb=%p err=%d)", pb, err);
@@ -513,10 +516,12 @@ class LWIPRawImpl : public Socket {
       // "An error code if there has been an error receiving Only return ERR_ABRT if you have
       // called tcp_abort from within the callback function!"
       rx_closed_ = true;
+      this->wake_();
       return ERR_OK;
     }
     if (pb == nullptr) {
       rx_closed_ = true;
+      this->wake_();
       return ERR_OK;
     }
     if (rx_buf_ == nullptr) {
@@ -526,9 +531,14 @@ class LWIPRawImpl : public Socket {
     } else {
       pbuf_cat(rx_buf_, pb);
     }
+    this->wake_();
     return ERR_OK;
   }
 
+#ifdef USE_TICKLESS_LOOP
+  void set_wake_component(Component *component) override { wake_component_ = component; }
+#endif
+
   static err_t s_accept_fn(void *arg, struct tcp_pcb *newpcb, err_t err) {
     LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
     return arg_this->accept_fn(newpcb, err);
@@ -545,6 +555,13 @@ class LWIPRawImpl : public Socket {
   }
 
  protected:
+  void wake_() {
+#ifdef USE_TICKLESS_LOOP
+    if (wake_component_ != nullptr)
+      wake_component_->wake();
+#endif
+  }
+
   int ip2sockaddr_(ip_addr_t *ip, uint16_t port, struct sockaddr *name, socklen_t *addrlen) {
     if (family_ == AF_INET) {
       if (*addrlen < sizeof(struct sockaddr_in)) {
@@ -594,6 +611,9 @@ class LWIPRawImpl : public Socket {
   // instead use it for determining whether to call lwip_output
   bool nodelay_ = false;
   sa_family_t family_ = 0;
+#ifdef USE_TICKLESS_LOOP
+  Component *wake_component_ = nullptr;
+#endif
 };
 
 std::unique_ptr<Socket> socket(int domain, int type, int protocol) {
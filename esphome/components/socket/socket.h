@@ -6,6 +6,9 @@
 #include "headers.h"
 
 namespace esphome {
+
+class Component;
+
 namespace socket {
 
 class Socket {
@@ -38,6 +41,12 @@ class Socket {
 
   virtual int setblocking(bool blocking) = 0;
   virtual int loop() { return 0; };
+
+  /** Call Component::wake() on \p component when this socket receives data or a connection.
+   *
+   * Only has an effect with the tickless main loop, see Component::idle().
+   */
+  virtual void set_wake_component(Component *component) {}
 };
 
 /// Create a socket of the given domain, type and protocol.
@@ -90,14 +90,20 @@ void SSD1351::setup() {
   this->turn_on();           // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  // only the regions changed since the last update are written
+  this->coalesce_dirty_();
+  for (uint8_t i = 0; i < this->dirty_count_; i++) {
+    const display::Rect &rect = this->dirty_rects_[i];
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(rect.x);                // set column start address
+    this->data(rect.x2() - 1);         // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(rect.y);                // set row start address
+    this->data(rect.y2() - 1);         // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(rect);
+  }
+  this->clear_dirty_();
 }
 void SSD1351::update() {
   this->do_update_();
@@ -153,10 +159,20 @@ void HOT SSD1351::draw_absolute_pixel_internal(int x, int y, Color color) {
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   // where should the bits go in the big buffer array? math...
   uint16_t pos = (x + y * this->get_width_internal()) * SSD1351_BYTESPERPIXEL;
+  if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+    return;
   this->buffer_[pos++] = (color565 >> 8) & 0xff;
   this->buffer_[pos] = color565 & 0xff;
+  this->mark_dirty_(x, y);
+}
+void HOT SSD1351::fill_span_internal_(int x, int y, int width, Color color) {
+  this->fill_span_rgb565_(x, y, width, display::ColorUtil::color_to_565(color));
+}
+void HOT SSD1351::blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  this->blit_rgb565_span_rgb565_(x, y, data, width, transparent);
 }
 void SSD1351::fill(Color color) {
+  this->mark_dirty_all_();
   const uint32_t color565 = display::ColorUtil::color_to_565(color);
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++) {
     if (i & 1) {
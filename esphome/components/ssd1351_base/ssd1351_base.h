@@ -36,10 +36,13 @@ class SSD1351 : public PollingComponent, public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Write the pixels of \p rect from the buffer, the display memory window is already set up.
+  virtual void write_display_data(const display::Rect &rect) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_span_internal_(int x, int y, int width, Color color) override;
+  void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
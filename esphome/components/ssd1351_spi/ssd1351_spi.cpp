@@ -53,7 +53,7 @@ void SPISSD1351::data(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1351::write_display_data() {
+void HOT SPISSD1351::write_display_data(const display::Rect &rect) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -61,7 +61,14 @@ void HOT SPISSD1351::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  const size_t row_length = size_t(this->get_width_internal()) * 2;
+  if (rect.w == this->get_width_internal()) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + rect.y * row_length, rect.h * row_length);
+  } else {
+    for (int row = rect.y; row < rect.y2(); row++)
+      this->write_array(this->buffer_ + row * row_length + rect.x * 2, rect.w * 2);
+  }
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
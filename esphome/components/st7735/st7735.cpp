@@ -289,6 +289,8 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  // the display memory still holds garbage from power-on, send the whole buffer on the first update
+  this->mark_dirty_all_();
 }
 
 void ST7735::update() {
@@ -314,13 +316,34 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     const uint32_t color332 = display::ColorUtil::color_to_332(color);
     uint16_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     const uint32_t color565 = display::ColorUtil::color_to_565(color);
     uint16_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y);
+}
+
+void HOT ST7735::fill_span_internal_(int x, int y, int width, Color color) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::fill_span_internal_(x, y, width, color);
+    return;
+  }
+  this->fill_span_rgb565_(x, y, width, display::ColorUtil::color_to_565(color));
+}
+
+void HOT ST7735::blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::blit_rgb565_span_internal_(x, y, data, width, transparent);
+    return;
+  }
+  this->blit_rgb565_span_rgb565_(x, y, data, width, transparent);
 }
 
 void ST7735::init_reset_() {
@@ -418,15 +441,25 @@ void HOT ST7735::senddata_(const uint8_t *data_bytes, uint8_t num_data_bytes) {
 }
 
 void HOT ST7735::write_display_data_() {
+  if (this->dirty_count_ == 0)
+    return;
+
+  this->coalesce_dirty_();
+  this->enable();
+  for (uint8_t i = 0; i < this->dirty_count_; i++)
+    this->write_display_window_(this->dirty_rects_[i]);
+  this->disable();
+  this->clear_dirty_();
+}
+
+void HOT ST7735::write_display_window_(const display::Rect &rect) {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
-
-  this->enable();
+  uint16_t x1 = offsetx + rect.x;
+  uint16_t x2 = x1 + rect.w - 1;
+  uint16_t y1 = offsety + rect.y;
+  uint16_t y2 = y1 + rect.h - 1;
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
@@ -445,10 +478,12 @@ void HOT ST7735::write_display_data_() {
   this->write_byte(ST77XX_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const size_t width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (size_t line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
+    for (int row = rect.y; row < rect.y2(); row++) {
+      const uint8_t *line = this->buffer_ + row * width;
+      for (int index = rect.x; index < rect.x2(); ++index) {
+        auto color332 = display::ColorUtil::to_color(line[index], display::ColorOrder::COLOR_ORDER_RGB,
                                                      display::ColorBitness::COLOR_BITNESS_332, true);
 
         auto color = display::ColorUtil::color_to_565(color332);
@@ -457,10 +492,13 @@ void HOT ST7735::write_display_data_() {
         this->write_byte(color & 0xff);
       }
     }
+  } else if (size_t(rect.w) == width) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
+    for (int row = rect.y; row < rect.y2(); row++)
+      this->write_array(this->buffer_ + (row * width + rect.x) * 2, rect.w * 2);
   }
-  this->disable();
 }
 
 void ST7735::spi_master_write_addr_(uint16_t addr1, uint16_t addr2) {
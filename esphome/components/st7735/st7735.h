@@ -63,11 +63,14 @@ class ST7735 : public PollingComponent,
   void writedata_(uint8_t value);
 
   void write_display_data_();
+  void write_display_window_(const display::Rect &rect);
 
   void init_reset_();
   void display_init_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_span_internal_(int x, int y, int width, Color color) override;
+  void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) override;
   void spi_master_write_addr_(uint16_t addr1, uint16_t addr2);
   void spi_master_write_color_(uint16_t color, uint16_t size);
 
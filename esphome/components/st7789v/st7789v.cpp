@@ -117,6 +117,8 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  // the display memory was cleared above as well, so nothing is dirty yet
+  this->clear_dirty_();
 }
 
 void ST7789V::dump_config() {
@@ -182,12 +184,22 @@ void ST7789V::set_model(ST7789VModel model) {
 }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  if (this->dirty_count_ == 0)
+    return;
 
+  this->coalesce_dirty_();
   this->enable();
+  for (uint8_t i = 0; i < this->dirty_count_; i++)
+    this->write_display_window_(this->dirty_rects_[i]);
+  this->disable();
+  this->clear_dirty_();
+}
+
+void ST7789V::write_display_window_(const display::Rect &rect) {
+  uint16_t x1 = this->offset_height_ + rect.x;
+  uint16_t x2 = x1 + rect.w - 1;
+  uint16_t y1 = this->offset_width_ + rect.y;
+  uint16_t y2 = y1 + rect.h - 1;
 
   // set column(x) address
   this->dc_pin_->digital_write(false);
@@ -204,21 +216,24 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const size_t width = this->get_width_internal();
   if (this->eightbitcolor_) {
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color = display::ColorUtil::color_to_565(
-            display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
-                                         display::ColorBitness::COLOR_BITNESS_332, true));
+    for (int row = rect.y; row < rect.y2(); row++) {
+      const uint8_t *line = this->buffer_ + row * width;
+      for (int index = rect.x; index < rect.x2(); ++index) {
+        auto color = display::ColorUtil::color_to_565(display::ColorUtil::to_color(
+            line[index], display::ColorOrder::COLOR_ORDER_RGB, display::ColorBitness::COLOR_BITNESS_332, true));
         this->write_byte((color >> 8) & 0xff);
         this->write_byte(color & 0xff);
       }
     }
+  } else if (size_t(rect.w) == width) {
+    // full rows are contiguous in the buffer
+    this->write_array(this->buffer_ + rect.y * width * 2, rect.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int row = rect.y; row < rect.y2(); row++)
+      this->write_array(this->buffer_ + (row * width + rect.x) * 2, rect.w * 2);
   }
-
-  this->disable();
 }
 
 void ST7789V::init_reset_() {
@@ -320,13 +335,34 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   if (this->eightbitcolor_) {
     auto color332 = display::ColorUtil::color_to_332(color);
     uint32_t pos = (x + y * this->get_width_internal());
+    if (this->buffer_[pos] == color332)
+      return;
     this->buffer_[pos] = color332;
   } else {
     auto color565 = display::ColorUtil::color_to_565(color);
     uint32_t pos = (x + y * this->get_width_internal()) * 2;
+    if (this->buffer_[pos] == ((color565 >> 8) & 0xff) && this->buffer_[pos + 1] == (color565 & 0xff))
+      return;
     this->buffer_[pos++] = (color565 >> 8) & 0xff;
     this->buffer_[pos] = color565 & 0xff;
   }
+  this->mark_dirty_(x, y);
+}
+
+void HOT ST7789V::fill_span_internal_(int x, int y, int width, Color color) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::fill_span_internal_(x, y, width, color);
+    return;
+  }
+  this->fill_span_rgb565_(x, y, width, display::ColorUtil::color_to_565(color));
+}
+
+void HOT ST7789V::blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::blit_rgb565_span_internal_(x, y, data, width, transparent);
+    return;
+  }
+  this->blit_rgb565_span_rgb565_(x, y, data, width, transparent);
 }
 
 const char *ST7789V::model_str_() {
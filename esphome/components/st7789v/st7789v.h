@@ -166,6 +166,7 @@ class ST7789V : public PollingComponent,
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
   void write_color_(uint16_t color, uint16_t size);
+  void write_display_window_(const display::Rect &rect);
 
   int get_height_internal() override { return this->height_; }
   int get_width_internal() override { return this->width_; }
@@ -174,6 +175,8 @@ class ST7789V : public PollingComponent,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_span_internal_(int x, int y, int width, Color color) override;
+  void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) override;
 
   const char *model_str_();
 };
@@ -0,0 +1,59 @@
+#include "route_index.h"
+
+#include <algorithm>
+
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace web_server {
+
+static const char *const TAG = "web_server";
+
+/// FNV-1 hash of \p str like fnv1_hash(), for strings that are not null-terminated.
+static uint32_t fnv1_hash(const StringRef &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= c;
+  }
+  return hash;
+}
+
+void RouteIndex::add(const char *domain, EntityBase *entity) {
+  const std::string object_id = entity->get_object_id();
+  if (this->object_ids_.size() + object_id.size() > UINT16_MAX) {
+    ESP_LOGW(TAG, "Too many entities, '%s' is not reachable by URL", object_id.c_str());
+    return;
+  }
+  this->routes_.push_back(Route{entity->get_object_id_hash(), static_cast<uint16_t>(this->object_ids_.size()),
+                                static_cast<uint16_t>(object_id.size()), domain, entity});
+  this->object_ids_ += object_id;
+}
+
+void RouteIndex::finish() {
+  std::sort(this->routes_.begin(), this->routes_.end(),
+            [](const Route &a, const Route &b) { return a.object_id_hash < b.object_id_hash; });
+  this->routes_.shrink_to_fit();
+  this->object_ids_.shrink_to_fit();
+}
+
+void RouteIndex::clear() {
+  this->routes_.clear();
+  this->object_ids_.clear();
+}
+
+EntityBase *RouteIndex::find(const StringRef &domain, const StringRef &id) const {
+  const uint32_t hash = fnv1_hash(id);
+  auto it = std::lower_bound(this->routes_.begin(), this->routes_.end(), hash,
+                             [](const Route &route, uint32_t value) { return route.object_id_hash < value; });
+  for (; it != this->routes_.end() && it->object_id_hash == hash; ++it) {
+    // the hash only narrows the search down, a colliding id must not reach another entity
+    const StringRef object_id(this->object_ids_.data() + it->object_id_offset, it->object_id_length);
+    if (domain == it->domain && id == object_id)
+      return it->entity;
+  }
+  return nullptr;
+}
+
+}  // namespace web_server
+}  // namespace esphome
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/entity_base.h"
+#include "esphome/core/string_ref.h"
+
+namespace esphome {
+namespace web_server {
+
+/** Finds the entity a request URL refers to by its domain and object id, without searching the entity lists.
+ *
+ * Routes are sorted by the hash of the object id like in the native API. The object ids are copied into a single
+ * buffer when the index is built, so lookups neither allocate nor build the object id of every candidate.
+ */
+class RouteIndex {
+ public:
+  /// Add \p entity under \p domain, which must outlive the index. Call finish() after adding all entities.
+  void add(const char *domain, EntityBase *entity);
+  /// Sort the routes for find() and release the unused capacity.
+  void finish();
+  void clear();
+
+  /// The entity with object id \p id in \p domain, nullptr if there is none.
+  EntityBase *find(const StringRef &domain, const StringRef &id) const;
+
+  size_t size() const { return this->routes_.size(); }
+
+ protected:
+  struct Route {
+    uint32_t object_id_hash;
+    uint16_t object_id_offset;  ///< Position of the object id in object_ids_
+    uint16_t object_id_length;
+    const char *domain;
+    EntityBase *entity;
+  };
+
+  std::vector<Route> routes_;  ///< Sorted by object_id_hash
+  std::string object_ids_;     ///< The object ids of all routes back to back
+};
+
+}  // namespace web_server
+}  // namespace esphome
@@ -11,6 +11,7 @@
 #include "StreamString.h"
 #endif
 
+#include <algorithm>
 #include <cstdlib>
 
 #ifdef USE_LIGHT
@@ -57,29 +58,28 @@ void write_row(AsyncResponseStream *stream, EntityBase *obj, const std::string &
 }
 #endif
 
-UrlMatch match_url(const std::string &url, bool only_domain = false) {
+UrlMatch match_url(const char *url, size_t length, bool only_domain = false) {
   UrlMatch match;
   match.valid = false;
-  size_t domain_end = url.find('/', 1);
-  if (domain_end == std::string::npos)
+  const char *end = url + length;
+  if (length == 0)
     return match;
-  match.domain = url.substr(1, domain_end - 1);
+  const char *domain_end = std::find(url + 1, end, '/');
+  if (domain_end == end)
+    return match;
+  match.domain = StringRef(url + 1, domain_end - url - 1);
   if (only_domain) {
     match.valid = true;
     return match;
   }
-  if (url.length() == domain_end - 1)
-    return match;
-  size_t id_begin = domain_end + 1;
-  size_t id_end = url.find('/', id_begin);
+  const char *id_begin = domain_end + 1;
+  const char *id_end = std::find(id_begin, end, '/');
   match.valid = true;
-  if (id_end == std::string::npos) {
-    match.id = url.substr(id_begin, url.length() - id_begin);
+  match.id = StringRef(id_begin, id_end - id_begin);
+  if (id_end == end)
     return match;
-  }
-  match.id = url.substr(id_begin, id_end - id_begin);
-  size_t method_begin = id_end + 1;
-  match.method = url.substr(method_begin, url.length() - method_begin);
+  const char *method_begin = id_end + 1;
+  match.method = StringRef(method_begin, end - method_begin);
   return match;
 }
 
@@ -103,18 +103,21 @@ void WebServer::set_js_include(const char *js_include) { this->js_include_ = js_
 #endif
 
 std::string WebServer::get_config_json() {
-  return json::build_json([this](JsonObject root) {
-    root["title"] = App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name();
-    root["comment"] = App.get_comment();
-    root["ota"] = this->allow_ota_;
-    root["log"] = this->expose_log_;
-    root["lang"] = "en";
-  });
+  std::string data;
+  json::JsonWriter root(data);
+  root["title"] = App.get_friendly_name().empty() ? App.get_name() : App.get_friendly_name();
+  root["comment"] = App.get_comment();
+  root["ota"] = this->allow_ota_;
+  root["log"] = this->expose_log_;
+  root["lang"] = "en";
+  root.finish();
+  return data;
 }
 
 void WebServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up web server...");
   this->setup_controller(this->include_internal_);
+  this->build_route_index_();
   this->base_->init();
 
   this->events_.onConnect([this](AsyncEventSourceClient *client) {
@@ -366,475 +369,484 @@ void WebServer::handle_js_request(AsyncWebServerRequest *request) {
 
 #ifdef USE_SENSOR
 void WebServer::on_sensor_update(sensor::Sensor *obj, float state) {
-  this->events_.send(this->sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->sensor_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (sensor::Sensor *obj : App.get_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = static_cast<sensor::Sensor *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data;
+  json::JsonWriter root(data);
+  this->sensor_json(root, obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", root.finish());
 }
-std::string WebServer::sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    std::string state;
-    if (std::isnan(value)) {
-      state = "NA";
-    } else {
-      state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
-      if (!obj->get_unit_of_measurement().empty())
-        state += " " + obj->get_unit_of_measurement();
-    }
-    set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
-  });
+void WebServer::sensor_json(json::JsonWriter &root, sensor::Sensor *obj, float value, JsonDetail start_config) {
+  std::string state;
+  if (std::isnan(value)) {
+    state = "NA";
+  } else {
+    state = value_accuracy_to_string(value, obj->get_accuracy_decimals());
+    if (!obj->get_unit_of_measurement().empty())
+      state += " " + obj->get_unit_of_measurement();
+  }
+  set_json_icon_state_value(root, obj, "sensor-" + obj->get_object_id(), state, value, start_config);
 }
 #endif
 
 #ifdef USE_TEXT_SENSOR
 void WebServer::on_text_sensor_update(text_sensor::TextSensor *obj, const std::string &state) {
-  this->events_.send(this->text_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->text_sensor_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (text_sensor::TextSensor *obj : App.get_text_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->text_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = static_cast<text_sensor::TextSensor *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data;
+  json::JsonWriter root(data);
+  this->text_sensor_json(root, obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", root.finish());
 }
-std::string WebServer::text_sensor_json(text_sensor::TextSensor *obj, const std::string &value,
-                                        JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
-  });
+void WebServer::text_sensor_json(json::JsonWriter &root, text_sensor::TextSensor *obj, const std::string &value,
+                                 JsonDetail start_config) {
+  set_json_icon_state_value(root, obj, "text_sensor-" + obj->get_object_id(), value, value, start_config);
 }
 #endif
 
 #ifdef USE_SWITCH
 void WebServer::on_switch_update(switch_::Switch *obj, bool state) {
-  this->events_.send(this->switch_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->switch_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
-std::string WebServer::switch_json(switch_::Switch *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
-    if (start_config == DETAIL_ALL) {
-      root["assumed_state"] = obj->assumed_state();
-    }
-  });
+void WebServer::switch_json(json::JsonWriter &root, switch_::Switch *obj, bool value, JsonDetail start_config) {
+  set_json_icon_state_value(root, obj, "switch-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
+  if (start_config == DETAIL_ALL) {
+    root["assumed_state"] = obj->assumed_state();
+  }
 }
 void WebServer::handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (switch_::Switch *obj : App.get_switches()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->switch_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      this->schedule_([obj]() { obj->turn_on(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->schedule_([obj]() { obj->turn_off(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  auto *obj = static_cast<switch_::Switch *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->switch_json(root, obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    this->schedule_([obj]() { obj->turn_on(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->schedule_([obj]() { obj->turn_off(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BUTTON
-std::string WebServer::button_json(button::Button *obj, JsonDetail start_config) {
-  return json::build_json(
-      [obj, start_config](JsonObject root) { set_json_id(root, obj, "button-" + obj->get_object_id(), start_config); });
+void WebServer::button_json(json::JsonWriter &root, button::Button *obj, JsonDetail start_config) {
+  set_json_id(root, obj, "button-" + obj->get_object_id(), start_config);
 }
 
 void WebServer::handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (button::Button *obj : App.get_buttons()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    if (request->method() == HTTP_POST && match.method == "press") {
-      this->schedule_([obj]() { obj->press(); });
-      request->send(200);
-      return;
-    } else {
-      request->send(404);
-    }
+  auto *obj = static_cast<button::Button *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_POST && match.method == "press") {
+    this->schedule_([obj]() { obj->press(); });
+    request->send(200);
+    return;
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_BINARY_SENSOR
 void WebServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
-  this->events_.send(this->binary_sensor_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->binary_sensor_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
-std::string WebServer::binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
-  });
+void WebServer::binary_sensor_json(json::JsonWriter &root, binary_sensor::BinarySensor *obj, bool value,
+                                   JsonDetail start_config) {
+  set_json_state_value(root, obj, "binary_sensor-" + obj->get_object_id(), value ? "ON" : "OFF", value, start_config);
 }
 void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (binary_sensor::BinarySensor *obj : App.get_binary_sensors()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-    std::string data = this->binary_sensor_json(obj, obj->state, DETAIL_STATE);
-    request->send(200, "application/json", data.c_str());
+  auto *obj = static_cast<binary_sensor::BinarySensor *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  std::string data;
+  json::JsonWriter root(data);
+  this->binary_sensor_json(root, obj, obj->state, DETAIL_STATE);
+  request->send(200, "application/json", root.finish());
 }
 #endif
 
 #ifdef USE_FAN
-void WebServer::on_fan_update(fan::Fan *obj) { this->events_.send(this->fan_json(obj, DETAIL_STATE).c_str(), "state"); }
-std::string WebServer::fan_json(fan::Fan *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state, start_config);
-    const auto traits = obj->get_traits();
-    if (traits.supports_speed()) {
-      root["speed_level"] = obj->speed;
-      root["speed_count"] = traits.supported_speed_count();
-    }
-    if (obj->get_traits().supports_oscillation())
-      root["oscillation"] = obj->oscillating;
-  });
+void WebServer::on_fan_update(fan::Fan *obj) {
+  json::JsonWriter root(this->event_buffer_);
+  this->fan_json(root, obj, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
+}
+void WebServer::fan_json(json::JsonWriter &root, fan::Fan *obj, JsonDetail start_config) {
+  set_json_state_value(root, obj, "fan-" + obj->get_object_id(), obj->state ? "ON" : "OFF", obj->state, start_config);
+  const auto traits = obj->get_traits();
+  if (traits.supports_speed()) {
+    root["speed_level"] = obj->speed;
+    root["speed_count"] = traits.supported_speed_count();
+  }
+  if (obj->get_traits().supports_oscillation())
+    root["oscillation"] = obj->oscillating;
 }
 void WebServer::handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (fan::Fan *obj : App.get_fans()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->fan_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("speed_level")) {
-        auto speed_level = request->getParam("speed_level")->value();
-        auto val = parse_number<int>(speed_level.c_str());
-        if (!val.has_value()) {
-          ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
-          return;
-        }
-        call.set_speed(*val);
+  auto *obj = static_cast<fan::Fan *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->fan_json(root, obj, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("speed_level")) {
+      auto speed_level = request->getParam("speed_level")->value();
+      auto val = parse_number<int>(speed_level.c_str());
+      if (!val.has_value()) {
+        ESP_LOGW(TAG, "Can't convert '%s' to number!", speed_level.c_str());
+        return;
       }
-      if (request->hasParam("oscillation")) {
-        auto speed = request->getParam("oscillation")->value();
-        auto val = parse_on_off(speed.c_str());
-        switch (val) {
-          case PARSE_ON:
-            call.set_oscillating(true);
-            break;
-          case PARSE_OFF:
-            call.set_oscillating(false);
-            break;
-          case PARSE_TOGGLE:
-            call.set_oscillating(!obj->oscillating);
-            break;
-          case PARSE_NONE:
-            request->send(404);
-            return;
-        }
+      call.set_speed(*val);
+    }
+    if (request->hasParam("oscillation")) {
+      auto speed = request->getParam("oscillation")->value();
+      auto val = parse_on_off(speed.c_str());
+      switch (val) {
+        case PARSE_ON:
+          call.set_oscillating(true);
+          break;
+        case PARSE_OFF:
+          call.set_oscillating(false);
+          break;
+        case PARSE_TOGGLE:
+          call.set_oscillating(!obj->oscillating);
+          break;
+        case PARSE_NONE:
+          request->send(404);
+          return;
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      this->schedule_([obj]() { obj->turn_off().perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    this->schedule_([obj]() { obj->turn_off().perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
 #endif
 
 #ifdef USE_LIGHT
 void WebServer::on_light_update(light::LightState *obj) {
-  this->events_.send(this->light_json(obj, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->light_json(root, obj, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (light::LightState *obj : App.get_lights()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->light_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "toggle") {
-      this->schedule_([obj]() { obj->toggle().perform(); });
-      request->send(200);
-    } else if (match.method == "turn_on") {
-      auto call = obj->turn_on();
-      if (request->hasParam("brightness")) {
-        auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
-        if (brightness.has_value()) {
-          call.set_brightness(*brightness / 255.0f);
-        }
-      }
-      if (request->hasParam("r")) {
-        auto r = parse_number<float>(request->getParam("r")->value().c_str());
-        if (r.has_value()) {
-          call.set_red(*r / 255.0f);
-        }
+  auto *obj = static_cast<light::LightState *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->light_json(root, obj, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+  } else if (match.method == "toggle") {
+    this->schedule_([obj]() { obj->toggle().perform(); });
+    request->send(200);
+  } else if (match.method == "turn_on") {
+    auto call = obj->turn_on();
+    if (request->hasParam("brightness")) {
+      auto brightness = parse_number<float>(request->getParam("brightness")->value().c_str());
+      if (brightness.has_value()) {
+        call.set_brightness(*brightness / 255.0f);
       }
-      if (request->hasParam("g")) {
-        auto g = parse_number<float>(request->getParam("g")->value().c_str());
-        if (g.has_value()) {
-          call.set_green(*g / 255.0f);
-        }
+    }
+    if (request->hasParam("r")) {
+      auto r = parse_number<float>(request->getParam("r")->value().c_str());
+      if (r.has_value()) {
+        call.set_red(*r / 255.0f);
       }
-      if (request->hasParam("b")) {
-        auto b = parse_number<float>(request->getParam("b")->value().c_str());
-        if (b.has_value()) {
-          call.set_blue(*b / 255.0f);
-        }
+    }
+    if (request->hasParam("g")) {
+      auto g = parse_number<float>(request->getParam("g")->value().c_str());
+      if (g.has_value()) {
+        call.set_green(*g / 255.0f);
       }
-      if (request->hasParam("white_value")) {
-        auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
-        if (white_value.has_value()) {
-          call.set_white(*white_value / 255.0f);
-        }
+    }
+    if (request->hasParam("b")) {
+      auto b = parse_number<float>(request->getParam("b")->value().c_str());
+      if (b.has_value()) {
+        call.set_blue(*b / 255.0f);
       }
-      if (request->hasParam("color_temp")) {
-        auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
-        if (color_temp.has_value()) {
-          call.set_color_temperature(*color_temp);
-        }
+    }
+    if (request->hasParam("white_value")) {
+      auto white_value = parse_number<float>(request->getParam("white_value")->value().c_str());
+      if (white_value.has_value()) {
+        call.set_white(*white_value / 255.0f);
       }
-      if (request->hasParam("flash")) {
-        auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
-        if (flash.has_value()) {
-          call.set_flash_length(*flash * 1000);
-        }
+    }
+    if (request->hasParam("color_temp")) {
+      auto color_temp = parse_number<float>(request->getParam("color_temp")->value().c_str());
+      if (color_temp.has_value()) {
+        call.set_color_temperature(*color_temp);
       }
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    }
+    if (request->hasParam("flash")) {
+      auto flash = parse_number<uint32_t>(request->getParam("flash")->value().c_str());
+      if (flash.has_value()) {
+        call.set_flash_length(*flash * 1000);
       }
-      if (request->hasParam("effect")) {
-        const char *effect = request->getParam("effect")->value().c_str();
-        call.set_effect(effect);
+    }
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
+    }
+    if (request->hasParam("effect")) {
+      const char *effect = request->getParam("effect")->value().c_str();
+      call.set_effect(effect);
+    }
 
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else if (match.method == "turn_off") {
-      auto call = obj->turn_off();
-      if (request->hasParam("transition")) {
-        auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
-        if (transition.has_value()) {
-          call.set_transition_length(*transition * 1000);
-        }
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else if (match.method == "turn_off") {
+    auto call = obj->turn_off();
+    if (request->hasParam("transition")) {
+      auto transition = parse_number<uint32_t>(request->getParam("transition")->value().c_str());
+      if (transition.has_value()) {
+        call.set_transition_length(*transition * 1000);
       }
-      this->schedule_([call]() mutable { call.perform(); });
-      request->send(200);
-    } else {
-      request->send(404);
     }
-    return;
+    this->schedule_([call]() mutable { call.perform(); });
+    request->send(200);
+  } else {
+    request->send(404);
   }
-  request->send(404);
 }
-std::string WebServer::light_json(light::LightState *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
+void WebServer::light_json(json::JsonWriter &root, light::LightState *obj, JsonDetail start_config) {
+  set_json_id(root, obj, "light-" + obj->get_object_id(), start_config);
+  // dump_json() writes the state for every known color mode, and keys can only be written once
+  if (!(obj->remote_values.get_color_mode() & light::ColorCapability::ON_OFF))
     root["state"] = obj->remote_values.is_on() ? "ON" : "OFF";
 
-    light::LightJSONSchema::dump_json(*obj, root);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("effects");
-      opt.add("None");
-      for (auto const &option : obj->get_effects()) {
-        opt.add(option->get_name());
-      }
+  light::LightJSONSchema::dump_json(*obj, root);
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("effects");
+    root.add("None");
+    for (auto const &option : obj->get_effects()) {
+      root.add(option->get_name());
     }
-  });
+    root.end_array();
+  }
 }
 #endif
 
 #ifdef USE_COVER
 void WebServer::on_cover_update(cover::Cover *obj) {
-  this->events_.send(this->cover_json(obj, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->cover_json(root, obj, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (cover::Cover *obj : App.get_covers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->cover_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      continue;
-    }
+  auto *obj = static_cast<cover::Cover *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->cover_json(root, obj, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+    return;
+  }
 
-    auto call = obj->make_call();
-    if (match.method == "open") {
-      call.set_command_open();
-    } else if (match.method == "close") {
-      call.set_command_close();
-    } else if (match.method == "stop") {
-      call.set_command_stop();
-    } else if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto call = obj->make_call();
+  if (match.method == "open") {
+    call.set_command_open();
+  } else if (match.method == "close") {
+    call.set_command_close();
+  } else if (match.method == "stop") {
+    call.set_command_stop();
+  } else if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    auto traits = obj->get_traits();
-    if ((request->hasParam("position") && !traits.get_supports_position()) ||
-        (request->hasParam("tilt") && !traits.get_supports_tilt())) {
-      request->send(409);
-      return;
-    }
+  auto traits = obj->get_traits();
+  if ((request->hasParam("position") && !traits.get_supports_position()) ||
+      (request->hasParam("tilt") && !traits.get_supports_tilt())) {
+    request->send(409);
+    return;
+  }
 
-    if (request->hasParam("position")) {
-      auto position = parse_number<float>(request->getParam("position")->value().c_str());
-      if (position.has_value()) {
-        call.set_position(*position);
-      }
+  if (request->hasParam("position")) {
+    auto position = parse_number<float>(request->getParam("position")->value().c_str());
+    if (position.has_value()) {
+      call.set_position(*position);
     }
-    if (request->hasParam("tilt")) {
-      auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
-      if (tilt.has_value()) {
-        call.set_tilt(*tilt);
-      }
+  }
+  if (request->hasParam("tilt")) {
+    auto tilt = parse_number<float>(request->getParam("tilt")->value().c_str());
+    if (tilt.has_value()) {
+      call.set_tilt(*tilt);
     }
-
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
-std::string WebServer::cover_json(cover::Cover *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
-                         obj->position, start_config);
-    root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
-
-    if (obj->get_traits().get_supports_tilt())
-      root["tilt"] = obj->tilt;
-  });
+void WebServer::cover_json(json::JsonWriter &root, cover::Cover *obj, JsonDetail start_config) {
+  set_json_state_value(root, obj, "cover-" + obj->get_object_id(), obj->is_fully_closed() ? "CLOSED" : "OPEN",
+                       obj->position, start_config);
+  root["current_operation"] = cover::cover_operation_to_str(obj->current_operation);
+
+  if (obj->get_traits().get_supports_tilt())
+    root["tilt"] = obj->tilt;
 }
 #endif
 
 #ifdef USE_NUMBER
 void WebServer::on_number_update(number::Number *obj, float state) {
-  this->events_.send(this->number_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->number_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_numbers()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->number_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
-
-    auto call = obj->make_call();
-    if (request->hasParam("value")) {
-      auto value = parse_number<float>(request->getParam("value")->value().c_str());
-      if (value.has_value())
-        call.set_value(*value);
-    }
-
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
+  auto *obj = static_cast<number::Number *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->number_json(root, obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+    return;
+  }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
+
+  auto call = obj->make_call();
+  if (request->hasParam("value")) {
+    auto value = parse_number<float>(request->getParam("value")->value().c_str());
+    if (value.has_value())
+      call.set_value(*value);
+  }
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
 
-std::string WebServer::number_json(number::Number *obj, float value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
-    if (start_config == DETAIL_ALL) {
-      root["min_value"] = obj->traits.get_min_value();
-      root["max_value"] = obj->traits.get_max_value();
-      root["step"] = obj->traits.get_step();
-      root["mode"] = (int) obj->traits.get_mode();
-    }
-    if (std::isnan(value)) {
-      root["value"] = "\"NaN\"";
-      root["state"] = "NA";
-    } else {
-      root["value"] = value;
-      std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
-      if (!obj->traits.get_unit_of_measurement().empty())
-        state += " " + obj->traits.get_unit_of_measurement();
-      root["state"] = state;
-    }
-  });
+void WebServer::number_json(json::JsonWriter &root, number::Number *obj, float value, JsonDetail start_config) {
+  set_json_id(root, obj, "number-" + obj->get_object_id(), start_config);
+  if (start_config == DETAIL_ALL) {
+    root["min_value"] = obj->traits.get_min_value();
+    root["max_value"] = obj->traits.get_max_value();
+    root["step"] = obj->traits.get_step();
+    root["mode"] = (int) obj->traits.get_mode();
+  }
+  if (std::isnan(value)) {
+    root["value"] = "\"NaN\"";
+    root["state"] = "NA";
+  } else {
+    root["value"] = value;
+    std::string state = value_accuracy_to_string(value, step_to_accuracy_decimals(obj->traits.get_step()));
+    if (!obj->traits.get_unit_of_measurement().empty())
+      state += " " + obj->traits.get_unit_of_measurement();
+    root["state"] = state;
+  }
 }
 #endif
 
 #ifdef USE_SELECT
 void WebServer::on_select_update(select::Select *obj, const std::string &state, size_t index) {
-  this->events_.send(this->select_json(obj, state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->select_json(root, obj, state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 void WebServer::handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_selects()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->select_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
-
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  auto *obj = static_cast<select::Select *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->select_json(root, obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+    return;
+  }
 
-    auto call = obj->make_call();
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    if (request->hasParam("option")) {
-      auto option = request->getParam("option")->value();
-      call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
-    }
+  auto call = obj->make_call();
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("option")) {
+    auto option = request->getParam("option")->value();
+    call.set_option(option.c_str());  // NOLINT(clang-diagnostic-deprecated-declarations)
   }
-  request->send(404);
+
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
 }
-std::string WebServer::select_json(select::Select *obj, const std::string &value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("option");
-      for (auto &option : obj->traits.get_options()) {
-        opt.add(option);
-      }
+void WebServer::select_json(json::JsonWriter &root, select::Select *obj, const std::string &value,
+                            JsonDetail start_config) {
+  set_json_state_value(root, obj, "select-" + obj->get_object_id(), value, value, start_config);
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("option");
+    for (auto &option : obj->traits.get_options()) {
+      root.add(option);
     }
-  });
+    root.end_array();
+  }
 }
 #endif
 
@@ -843,204 +855,213 @@ std::string WebServer::select_json(select::Select *obj, const std::string &value
 
 #ifdef USE_CLIMATE
 void WebServer::on_climate_update(climate::Climate *obj) {
-  this->events_.send(this->climate_json(obj, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->climate_json(root, obj, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
 
 void WebServer::handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (auto *obj : App.get_climates()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->climate_json(obj, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  auto *obj = static_cast<climate::Climate *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->climate_json(root, obj, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+    return;
+  }
 
-    if (match.method != "set") {
-      request->send(404);
-      return;
-    }
+  if (match.method != "set") {
+    request->send(404);
+    return;
+  }
 
-    auto call = obj->make_call();
+  auto call = obj->make_call();
 
-    if (request->hasParam("mode")) {
-      auto mode = request->getParam("mode")->value();
-      call.set_mode(mode.c_str());
-    }
-
-    if (request->hasParam("target_temperature_high")) {
-      auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
-      if (target_temperature_high.has_value())
-        call.set_target_temperature_high(*target_temperature_high);
-    }
+  if (request->hasParam("mode")) {
+    auto mode = request->getParam("mode")->value();
+    call.set_mode(mode.c_str());
+  }
 
-    if (request->hasParam("target_temperature_low")) {
-      auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
-      if (target_temperature_low.has_value())
-        call.set_target_temperature_low(*target_temperature_low);
-    }
+  if (request->hasParam("target_temperature_high")) {
+    auto target_temperature_high = parse_number<float>(request->getParam("target_temperature_high")->value().c_str());
+    if (target_temperature_high.has_value())
+      call.set_target_temperature_high(*target_temperature_high);
+  }
 
-    if (request->hasParam("target_temperature")) {
-      auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
-      if (target_temperature.has_value())
-        call.set_target_temperature(*target_temperature);
-    }
+  if (request->hasParam("target_temperature_low")) {
+    auto target_temperature_low = parse_number<float>(request->getParam("target_temperature_low")->value().c_str());
+    if (target_temperature_low.has_value())
+      call.set_target_temperature_low(*target_temperature_low);
+  }
 
-    this->schedule_([call]() mutable { call.perform(); });
-    request->send(200);
-    return;
+  if (request->hasParam("target_temperature")) {
+    auto target_temperature = parse_number<float>(request->getParam("target_temperature")->value().c_str());
+    if (target_temperature.has_value())
+      call.set_target_temperature(*target_temperature);
   }
-  request->send(404);
-}
 
-std::string WebServer::climate_json(climate::Climate *obj, JsonDetail start_config) {
-  return json::build_json([obj, start_config](JsonObject root) {
-    set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
-    const auto traits = obj->get_traits();
-    int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
-    int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
-    char buf[16];
-
-    if (start_config == DETAIL_ALL) {
-      JsonArray opt = root.createNestedArray("modes");
-      for (climate::ClimateMode m : traits.get_supported_modes())
-        opt.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("fan_modes");
-        for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
-          opt.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
-      }
+  this->schedule_([call]() mutable { call.perform(); });
+  request->send(200);
+}
 
-      if (!traits.get_supported_custom_fan_modes().empty()) {
-        JsonArray opt = root.createNestedArray("custom_fan_modes");
-        for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
-          opt.add(custom_fan_mode);
-      }
-      if (traits.get_supports_swing_modes()) {
-        JsonArray opt = root.createNestedArray("swing_modes");
-        for (auto swing_mode : traits.get_supported_swing_modes())
-          opt.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
-      }
-      if (traits.get_supports_presets() && obj->preset.has_value()) {
-        JsonArray opt = root.createNestedArray("presets");
-        for (climate::ClimatePreset m : traits.get_supported_presets())
-          opt.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
-      }
-      if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-        JsonArray opt = root.createNestedArray("custom_presets");
-        for (auto const &custom_preset : traits.get_supported_custom_presets())
-          opt.add(custom_preset);
-      }
+void WebServer::climate_json(json::JsonWriter &root, climate::Climate *obj, JsonDetail start_config) {
+  set_json_id(root, obj, "climate-" + obj->get_object_id(), start_config);
+  const auto traits = obj->get_traits();
+  int8_t target_accuracy = traits.get_target_temperature_accuracy_decimals();
+  int8_t current_accuracy = traits.get_current_temperature_accuracy_decimals();
+  char buf[16];
+
+  if (start_config == DETAIL_ALL) {
+    root.begin_array("modes");
+    for (climate::ClimateMode m : traits.get_supported_modes())
+      root.add(PSTR_LOCAL(climate::climate_mode_to_string(m)));
+    root.end_array();
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      root.begin_array("fan_modes");
+      for (climate::ClimateFanMode m : traits.get_supported_fan_modes())
+        root.add(PSTR_LOCAL(climate::climate_fan_mode_to_string(m)));
+      root.end_array();
     }
 
-    bool has_state = false;
-    root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
-    root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
-    root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
-    root["step"] = traits.get_visual_target_temperature_step();
-    if (traits.get_supports_action()) {
-      root["action"] = PSTR_LOCAL(climate_action_to_string(obj->action));
-      root["state"] = root["action"];
-      has_state = true;
+    if (!traits.get_supported_custom_fan_modes().empty()) {
+      root.begin_array("custom_fan_modes");
+      for (auto const &custom_fan_mode : traits.get_supported_custom_fan_modes())
+        root.add(custom_fan_mode);
+      root.end_array();
     }
-    if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
-      root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
-    }
-    if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
-      root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+    if (traits.get_supports_swing_modes()) {
+      root.begin_array("swing_modes");
+      for (auto swing_mode : traits.get_supported_swing_modes())
+        root.add(PSTR_LOCAL(climate::climate_swing_mode_to_string(swing_mode)));
+      root.end_array();
     }
     if (traits.get_supports_presets() && obj->preset.has_value()) {
-      root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+      root.begin_array("presets");
+      for (climate::ClimatePreset m : traits.get_supported_presets())
+        root.add(PSTR_LOCAL(climate::climate_preset_to_string(m)));
+      root.end_array();
     }
     if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
-      root["custom_preset"] = obj->custom_preset.value().c_str();
+      root.begin_array("custom_presets");
+      for (auto const &custom_preset : traits.get_supported_custom_presets())
+        root.add(custom_preset);
+      root.end_array();
     }
-    if (traits.get_supports_swing_modes()) {
-      root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
-    }
-    if (traits.get_supports_current_temperature()) {
-      if (!std::isnan(obj->current_temperature)) {
-        root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
-      } else {
-        root["current_temperature"] = "NA";
-      }
-    }
-    if (traits.get_supports_two_point_target_temperature()) {
-      root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
-      root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
-      if (!has_state) {
-        root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
-                                                 target_accuracy);
-      }
+  }
+
+  bool has_state = false;
+  root["mode"] = PSTR_LOCAL(climate_mode_to_string(obj->mode));
+  root["max_temp"] = value_accuracy_to_string(traits.get_visual_max_temperature(), target_accuracy);
+  root["min_temp"] = value_accuracy_to_string(traits.get_visual_min_temperature(), target_accuracy);
+  root["step"] = traits.get_visual_target_temperature_step();
+  if (traits.get_supports_action()) {
+    const char *action = PSTR_LOCAL(climate_action_to_string(obj->action));
+    root["action"] = action;
+    root["state"] = action;
+    has_state = true;
+  }
+  if (traits.get_supports_fan_modes() && obj->fan_mode.has_value()) {
+    root["fan_mode"] = PSTR_LOCAL(climate_fan_mode_to_string(obj->fan_mode.value()));
+  }
+  if (!traits.get_supported_custom_fan_modes().empty() && obj->custom_fan_mode.has_value()) {
+    root["custom_fan_mode"] = obj->custom_fan_mode.value().c_str();
+  }
+  if (traits.get_supports_presets() && obj->preset.has_value()) {
+    root["preset"] = PSTR_LOCAL(climate_preset_to_string(obj->preset.value()));
+  }
+  if (!traits.get_supported_custom_presets().empty() && obj->custom_preset.has_value()) {
+    root["custom_preset"] = obj->custom_preset.value().c_str();
+  }
+  if (traits.get_supports_swing_modes()) {
+    root["swing_mode"] = PSTR_LOCAL(climate_swing_mode_to_string(obj->swing_mode));
+  }
+  if (traits.get_supports_current_temperature()) {
+    if (!std::isnan(obj->current_temperature)) {
+      root["current_temperature"] = value_accuracy_to_string(obj->current_temperature, current_accuracy);
     } else {
-      root["target_temperature"] = value_accuracy_to_string(obj->target_temperature, target_accuracy);
-      if (!has_state)
-        root["state"] = root["target_temperature"];
+      root["current_temperature"] = "NA";
     }
-  });
+  }
+  if (traits.get_supports_two_point_target_temperature()) {
+    root["target_temperature_low"] = value_accuracy_to_string(obj->target_temperature_low, target_accuracy);
+    root["target_temperature_high"] = value_accuracy_to_string(obj->target_temperature_high, target_accuracy);
+    if (!has_state) {
+      root["state"] = value_accuracy_to_string((obj->target_temperature_high + obj->target_temperature_low) / 2.0f,
+                                               target_accuracy);
+    }
+  } else {
+    std::string target_temperature = value_accuracy_to_string(obj->target_temperature, target_accuracy);
+    root["target_temperature"] = target_temperature;
+    if (!has_state)
+      root["state"] = target_temperature;
+  }
 }
 #endif
 
 #ifdef USE_LOCK
 void WebServer::on_lock_update(lock::Lock *obj) {
-  this->events_.send(this->lock_json(obj, obj->state, DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->lock_json(root, obj, obj->state, DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
-std::string WebServer::lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
-                              start_config);
-  });
+void WebServer::lock_json(json::JsonWriter &root, lock::Lock *obj, lock::LockState value, JsonDetail start_config) {
+  set_json_icon_state_value(root, obj, "lock-" + obj->get_object_id(), lock::lock_state_to_string(value), value,
+                            start_config);
 }
 void WebServer::handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (lock::Lock *obj : App.get_locks()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->lock_json(obj, obj->state, DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-    } else if (match.method == "lock") {
-      this->schedule_([obj]() { obj->lock(); });
-      request->send(200);
-    } else if (match.method == "unlock") {
-      this->schedule_([obj]() { obj->unlock(); });
-      request->send(200);
-    } else if (match.method == "open") {
-      this->schedule_([obj]() { obj->open(); });
-      request->send(200);
-    } else {
-      request->send(404);
-    }
+  auto *obj = static_cast<lock::Lock *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
     return;
   }
-  request->send(404);
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->lock_json(root, obj, obj->state, DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+  } else if (match.method == "lock") {
+    this->schedule_([obj]() { obj->lock(); });
+    request->send(200);
+  } else if (match.method == "unlock") {
+    this->schedule_([obj]() { obj->unlock(); });
+    request->send(200);
+  } else if (match.method == "open") {
+    this->schedule_([obj]() { obj->open(); });
+    request->send(200);
+  } else {
+    request->send(404);
+  }
 }
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
 void WebServer::on_alarm_control_panel_update(alarm_control_panel::AlarmControlPanel *obj) {
-  this->events_.send(this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE).c_str(), "state");
+  json::JsonWriter root(this->event_buffer_);
+  this->alarm_control_panel_json(root, obj, obj->get_state(), DETAIL_STATE);
+  this->events_.send(root.finish(), "state");
 }
-std::string WebServer::alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
-                                                alarm_control_panel::AlarmControlPanelState value,
-                                                JsonDetail start_config) {
-  return json::build_json([obj, value, start_config](JsonObject root) {
-    char buf[16];
-    set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
-                              PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
-  });
+void WebServer::alarm_control_panel_json(json::JsonWriter &root, alarm_control_panel::AlarmControlPanel *obj,
+                                         alarm_control_panel::AlarmControlPanelState value, JsonDetail start_config) {
+  char buf[16];
+  set_json_icon_state_value(root, obj, "alarm-control-panel-" + obj->get_object_id(),
+                            PSTR_LOCAL(alarm_control_panel_state_to_string(value)), value, start_config);
 }
 void WebServer::handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match) {
-  for (alarm_control_panel::AlarmControlPanel *obj : App.get_alarm_control_panels()) {
-    if (obj->get_object_id() != match.id)
-      continue;
-
-    if (request->method() == HTTP_GET) {
-      std::string data = this->alarm_control_panel_json(obj, obj->get_state(), DETAIL_STATE);
-      request->send(200, "application/json", data.c_str());
-      return;
-    }
+  auto *obj = static_cast<alarm_control_panel::AlarmControlPanel *>(match.entity);
+  if (obj == nullptr) {
+    request->send(404);
+    return;
+  }
+  if (request->method() == HTTP_GET) {
+    std::string data;
+    json::JsonWriter root(data);
+    this->alarm_control_panel_json(root, obj, obj->get_state(), DETAIL_STATE);
+    request->send(200, "application/json", root.finish());
+    return;
   }
   request->send(404);
 }
@@ -1060,7 +1081,8 @@ bool WebServer::canHandle(AsyncWebServerRequest *request) {
     return true;
 #endif
 
-  UrlMatch match = match_url(request->url().c_str(), true);
+  const auto &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length(), true);
   if (!match.valid)
     return false;
 #ifdef USE_SENSOR
@@ -1150,7 +1172,10 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
   }
 #endif
 
-  UrlMatch match = match_url(request->url().c_str());
+  const auto &url = request->url();
+  UrlMatch match = match_url(url.c_str(), url.length());
+  if (match.valid)
+    match.entity = this->routes_.find(match.domain, match.id);
 #ifdef USE_SENSOR
   if (match.domain == "sensor") {
     this->handle_sensor_request(request, match);
@@ -1247,6 +1272,63 @@ void WebServer::handleRequest(AsyncWebServerRequest *request) {
 
 bool WebServer::isRequestHandlerTrivial() { return false; }
 
+void WebServer::build_route_index_() {
+  this->routes_.clear();
+#ifdef USE_SENSOR
+  for (auto *obj : App.get_sensors())
+    this->routes_.add("sensor", obj);
+#endif
+#ifdef USE_SWITCH
+  for (auto *obj : App.get_switches())
+    this->routes_.add("switch", obj);
+#endif
+#ifdef USE_BUTTON
+  for (auto *obj : App.get_buttons())
+    this->routes_.add("button", obj);
+#endif
+#ifdef USE_BINARY_SENSOR
+  for (auto *obj : App.get_binary_sensors())
+    this->routes_.add("binary_sensor", obj);
+#endif
+#ifdef USE_FAN
+  for (auto *obj : App.get_fans())
+    this->routes_.add("fan", obj);
+#endif
+#ifdef USE_LIGHT
+  for (auto *obj : App.get_lights())
+    this->routes_.add("light", obj);
+#endif
+#ifdef USE_TEXT_SENSOR
+  for (auto *obj : App.get_text_sensors())
+    this->routes_.add("text_sensor", obj);
+#endif
+#ifdef USE_COVER
+  for (auto *obj : App.get_covers())
+    this->routes_.add("cover", obj);
+#endif
+#ifdef USE_NUMBER
+  for (auto *obj : App.get_numbers())
+    this->routes_.add("number", obj);
+#endif
+#ifdef USE_SELECT
+  for (auto *obj : App.get_selects())
+    this->routes_.add("select", obj);
+#endif
+#ifdef USE_CLIMATE
+  for (auto *obj : App.get_climates())
+    this->routes_.add("climate", obj);
+#endif
+#ifdef USE_LOCK
+  for (auto *obj : App.get_locks())
+    this->routes_.add("lock", obj);
+#endif
+#ifdef USE_ALARM_CONTROL_PANEL
+  for (auto *obj : App.get_alarm_control_panels())
+    this->routes_.add("alarm_control_panel", obj);
+#endif
+  this->routes_.finish();
+}
+
 void WebServer::schedule_(std::function<void()> &&f) {
 #ifdef USE_ESP32
   xSemaphoreTake(this->to_schedule_lock_, portMAX_DELAY);
@@ -1,10 +1,14 @@
 #pragma once
 
 #include "list_entities.h"
+#include "route_index.h"
 
+#include "esphome/components/json/json_util.h"
 #include "esphome/components/web_server_base/web_server_base.h"
 #include "esphome/core/component.h"
 #include "esphome/core/controller.h"
+#include "esphome/core/entity_base.h"
+#include "esphome/core/string_ref.h"
 
 #include <vector>
 #ifdef USE_ESP32
@@ -31,12 +35,13 @@ extern const size_t ESPHOME_WEBSERVER_JS_INCLUDE_SIZE;
 namespace esphome {
 namespace web_server {
 
-/// Internal helper struct that is used to parse incoming URLs
+/// Internal helper struct that is used to parse incoming URLs, the parts point into the URL string
 struct UrlMatch {
-  std::string domain;  ///< The domain of the component, for example "sensor"
-  std::string id;      ///< The id of the device that's being accessed, for example "living_room_fan"
-  std::string method;  ///< The method that's being called, for example "turn_on"
-  bool valid;          ///< Whether this match is valid
+  StringRef domain;              ///< The domain of the component, for example "sensor"
+  StringRef id;                  ///< The id of the device that's being accessed, for example "living_room_fan"
+  StringRef method;              ///< The method that's being called, for example "turn_on"
+  bool valid;                    ///< Whether this match is valid
+  EntityBase *entity{nullptr};  ///< The entity with this domain and id, nullptr if there is none
 };
 
 enum JsonDetail { DETAIL_ALL, DETAIL_STATE };
@@ -135,8 +140,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a sensor request under '/sensor/<id>'.
   void handle_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the sensor state with its value as a JSON string.
-  std::string sensor_json(sensor::Sensor *obj, float value, JsonDetail start_config);
+  /// Write the sensor state with its value as JSON members of \p root.
+  void sensor_json(json::JsonWriter &root, sensor::Sensor *obj, float value, JsonDetail start_config);
 #endif
 
 #ifdef USE_SWITCH
@@ -145,16 +150,16 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a switch request under '/switch/<id>/</turn_on/turn_off/toggle>'.
   void handle_switch_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the switch state with its value as a JSON string.
-  std::string switch_json(switch_::Switch *obj, bool value, JsonDetail start_config);
+  /// Write the switch state with its value as JSON members of \p root.
+  void switch_json(json::JsonWriter &root, switch_::Switch *obj, bool value, JsonDetail start_config);
 #endif
 
 #ifdef USE_BUTTON
   /// Handle a button request under '/button/<id>/press'.
   void handle_button_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the button details with its value as a JSON string.
-  std::string button_json(button::Button *obj, JsonDetail start_config);
+  /// Write the button details with its value as JSON members of \p root.
+  void button_json(json::JsonWriter &root, button::Button *obj, JsonDetail start_config);
 #endif
 
 #ifdef USE_BINARY_SENSOR
@@ -163,8 +168,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a binary sensor request under '/binary_sensor/<id>'.
   void handle_binary_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the binary sensor state with its value as a JSON string.
-  std::string binary_sensor_json(binary_sensor::BinarySensor *obj, bool value, JsonDetail start_config);
+  /// Write the binary sensor state with its value as JSON members of \p root.
+  void binary_sensor_json(json::JsonWriter &root, binary_sensor::BinarySensor *obj, bool value,
+                          JsonDetail start_config);
 #endif
 
 #ifdef USE_FAN
@@ -173,8 +179,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a fan request under '/fan/<id>/</turn_on/turn_off/toggle>'.
   void handle_fan_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the fan state as a JSON string.
-  std::string fan_json(fan::Fan *obj, JsonDetail start_config);
+  /// Write the fan state as JSON members of \p root.
+  void fan_json(json::JsonWriter &root, fan::Fan *obj, JsonDetail start_config);
 #endif
 
 #ifdef USE_LIGHT
@@ -183,8 +189,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a light request under '/light/<id>/</turn_on/turn_off/toggle>'.
   void handle_light_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the light state as a JSON string.
-  std::string light_json(light::LightState *obj, JsonDetail start_config);
+  /// Write the light state as JSON members of \p root.
+  void light_json(json::JsonWriter &root, light::LightState *obj, JsonDetail start_config);
 #endif
 
 #ifdef USE_TEXT_SENSOR
@@ -193,8 +199,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a text sensor request under '/text_sensor/<id>'.
   void handle_text_sensor_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the text sensor state with its value as a JSON string.
-  std::string text_sensor_json(text_sensor::TextSensor *obj, const std::string &value, JsonDetail start_config);
+  /// Write the text sensor state with its value as JSON members of \p root.
+  void text_sensor_json(json::JsonWriter &root, text_sensor::TextSensor *obj, const std::string &value,
+                        JsonDetail start_config);
 #endif
 
 #ifdef USE_COVER
@@ -203,8 +210,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a cover request under '/cover/<id>/<open/close/stop/set>'.
   void handle_cover_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the cover state as a JSON string.
-  std::string cover_json(cover::Cover *obj, JsonDetail start_config);
+  /// Write the cover state as JSON members of \p root.
+  void cover_json(json::JsonWriter &root, cover::Cover *obj, JsonDetail start_config);
 #endif
 
 #ifdef USE_NUMBER
@@ -212,8 +219,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a number request under '/number/<id>'.
   void handle_number_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the number state with its value as a JSON string.
-  std::string number_json(number::Number *obj, float value, JsonDetail start_config);
+  /// Write the number state with its value as JSON members of \p root.
+  void number_json(json::JsonWriter &root, number::Number *obj, float value, JsonDetail start_config);
 #endif
 
 #ifdef USE_SELECT
@@ -221,8 +228,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a select request under '/select/<id>'.
   void handle_select_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the select state with its value as a JSON string.
-  std::string select_json(select::Select *obj, const std::string &value, JsonDetail start_config);
+  /// Write the select state with its value as JSON members of \p root.
+  void select_json(json::JsonWriter &root, select::Select *obj, const std::string &value, JsonDetail start_config);
 #endif
 
 #ifdef USE_CLIMATE
@@ -230,8 +237,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a climate request under '/climate/<id>'.
   void handle_climate_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the climate details
-  std::string climate_json(climate::Climate *obj, JsonDetail start_config);
+  /// Write the climate details as JSON members of \p root.
+  void climate_json(json::JsonWriter &root, climate::Climate *obj, JsonDetail start_config);
 #endif
 
 #ifdef USE_LOCK
@@ -240,8 +247,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a lock request under '/lock/<id>/</lock/unlock/open>'.
   void handle_lock_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the lock state with its value as a JSON string.
-  std::string lock_json(lock::Lock *obj, lock::LockState value, JsonDetail start_config);
+  /// Write the lock state with its value as JSON members of \p root.
+  void lock_json(json::JsonWriter &root, lock::Lock *obj, lock::LockState value, JsonDetail start_config);
 #endif
 
 #ifdef USE_ALARM_CONTROL_PANEL
@@ -250,9 +257,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
   /// Handle a alarm_control_panel request under '/alarm_control_panel/<id>'.
   void handle_alarm_control_panel_request(AsyncWebServerRequest *request, const UrlMatch &match);
 
-  /// Dump the alarm_control_panel state with its value as a JSON string.
-  std::string alarm_control_panel_json(alarm_control_panel::AlarmControlPanel *obj,
-                                       alarm_control_panel::AlarmControlPanelState value, JsonDetail start_config);
+  /// Write the alarm_control_panel state with its value as JSON members of \p root.
+  void alarm_control_panel_json(json::JsonWriter &root, alarm_control_panel::AlarmControlPanel *obj,
+                                alarm_control_panel::AlarmControlPanelState value, JsonDetail start_config);
 #endif
 
   /// Override the web handler's canHandle method.
@@ -264,6 +271,8 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 
  protected:
   void schedule_(std::function<void()> &&f);
+  /// Index all entities by domain and object id, so requests don't have to search the entity lists.
+  void build_route_index_();
   friend ListEntitiesIterator;
   web_server_base::WebServerBase *base_;
   AsyncEventSource events_{"/events"};
@@ -278,6 +287,9 @@ class WebServer : public Controller, public Component, public AsyncWebHandler {
 #ifdef USE_WEBSERVER_JS_INCLUDE
   const char *js_include_{nullptr};
 #endif
+  RouteIndex routes_;
+  /// Serialized state events, reused so steady-state events don't allocate. Only used from the main loop.
+  std::string event_buffer_;
   bool include_internal_{false};
   bool allow_ota_{true};
   bool expose_log_{true};
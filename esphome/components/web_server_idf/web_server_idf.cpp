@@ -1,6 +1,8 @@
 #ifdef USE_ESP_IDF
 
+#include <cinttypes>
 #include <cstdarg>
+#include <cstring>
 
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
@@ -325,47 +327,58 @@ void AsyncEventSourceResponse::send(const char *message, const char *event, uint
     return;
   }
 
-  std::string ev;
+  // Only the event fields are framed in a small scratch buffer, the message itself is sent straight from the
+  // caller's buffer so large state events are not copied. The chunk size prelude goes in front of the fields once
+  // the size of the chunk is known.
+  static const size_t PRELUDE_SIZE = 2 * sizeof(unsigned) + CRLF_LEN;
+  char buf[PRELUDE_SIZE + 96];
+  char *fields = buf + PRELUDE_SIZE;
+  const size_t fields_size = sizeof(buf) - PRELUDE_SIZE;
+  size_t len = 0;
 
   if (reconnect) {
-    ev.append("retry: ", sizeof("retry: ") - 1);
-    ev.append(to_string(reconnect));
-    ev.append(CRLF_STR, CRLF_LEN);
+    len += snprintf(fields + len, fields_size - len, "retry: %" PRIu32 CRLF_STR, reconnect);
   }
 
-  if (id) {
-    ev.append("id: ", sizeof("id: ") - 1);
-    ev.append(to_string(id));
-    ev.append(CRLF_STR, CRLF_LEN);
+  if (id && len < fields_size) {
+    len += snprintf(fields + len, fields_size - len, "id: %" PRIu32 CRLF_STR, id);
   }
 
-  if (event && *event) {
-    ev.append("event: ", sizeof("event: ") - 1);
-    ev.append(event);
-    ev.append(CRLF_STR, CRLF_LEN);
+  if (event && *event && len < fields_size) {
+    len += snprintf(fields + len, fields_size - len, "event: %s" CRLF_STR, event);
   }
 
-  if (message && *message) {
-    ev.append("data: ", sizeof("data: ") - 1);
-    ev.append(message);
-    ev.append(CRLF_STR, CRLF_LEN);
+  const size_t message_len = message != nullptr ? strlen(message) : 0;
+  if (message_len > 0 && len < fields_size) {
+    len += snprintf(fields + len, fields_size - len, "data: ");
   }
 
-  if (ev.empty()) {
+  if (len >= fields_size) {
+    ESP_LOGW(TAG, "Event fields too long, dropping event");
+    return;
+  }
+  if (len == 0) {
     return;
   }
-
-  ev.append(CRLF_STR, CRLF_LEN);
 
   // Sending chunked content prelude
-  auto cs = str_snprintf("%x" CRLF_STR, 4 * sizeof(ev.size()) + CRLF_LEN, ev.size());
-  httpd_socket_send(this->hd_, this->fd_, cs.c_str(), cs.size(), 0);
-
-  // Sendiing content chunk
-  httpd_socket_send(this->hd_, this->fd_, ev.c_str(), ev.size(), 0);
-
-  // Indicate end of chunk
-  httpd_socket_send(this->hd_, this->fd_, CRLF_STR, CRLF_LEN, 0);
+  size_t size = len + CRLF_LEN;
+  if (message_len > 0)
+    size += message_len + CRLF_LEN;
+  char prelude[PRELUDE_SIZE + 1];
+  int prelude_len = snprintf(prelude, sizeof(prelude), "%x" CRLF_STR, static_cast<unsigned>(size));
+  memcpy(fields - prelude_len, prelude, prelude_len);
+  httpd_socket_send(this->hd_, this->fd_, fields - prelude_len, prelude_len + len, 0);
+
+  // Sending content chunk
+  if (message_len > 0) {
+    httpd_socket_send(this->hd_, this->fd_, message, message_len, 0);
+  }
+
+  // End the data line, the event and the chunk
+  static const char *const TAIL = CRLF_STR CRLF_STR CRLF_STR;
+  httpd_socket_send(this->hd_, this->fd_, message_len > 0 ? TAIL : TAIL + CRLF_LEN,
+                    message_len > 0 ? 3 * CRLF_LEN : 2 * CRLF_LEN, 0);
 }
 
 }  // namespace web_server_idf
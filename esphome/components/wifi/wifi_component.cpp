@@ -42,6 +42,11 @@ void WiFiComponent::setup() {
   } else {
     this->state_ = WIFI_COMPONENT_STATE_DISABLED;
   }
+
+#ifdef USE_TICKLESS_LOOP
+  // connection loss is also noticed by polling, and state changes from outside loop() must be picked up
+  this->set_interval("tickless_wake", 1000, [this]() { this->wake(); });
+#endif
 }
 
 void WiFiComponent::start() {
@@ -145,6 +150,10 @@ void WiFiComponent::loop() {
       case WIFI_COMPONENT_STATE_AP:
         break;
       case WIFI_COMPONENT_STATE_DISABLED:
+#ifdef USE_TICKLESS_LOOP
+        // enable() wakes the component
+        this->idle();
+#endif
         return;
     }
 
@@ -176,6 +185,13 @@ void WiFiComponent::loop() {
       }
     }
   }
+
+#ifdef USE_TICKLESS_LOOP
+  // Connecting and scanning are polled, a stable connection or access point only needs a look on events
+  if (this->state_ == WIFI_COMPONENT_STATE_STA_CONNECTED || this->state_ == WIFI_COMPONENT_STATE_AP ||
+      this->state_ == WIFI_COMPONENT_STATE_OFF)
+    this->idle();
+#endif
 }
 
 WiFiComponent::WiFiComponent() { global_wifi_component = this; }
@@ -272,6 +288,10 @@ void WiFiComponent::save_wifi_sta(const std::string &ssid, const std::string &pa
 
 void WiFiComponent::start_connecting(const WiFiAP &ap, bool two) {
   ESP_LOGI(TAG, "WiFi Connecting to '%s'...", ap.get_ssid().c_str());
+#ifdef USE_TICKLESS_LOOP
+  // also called from outside loop(), e.g. when new credentials are saved, connecting is polled
+  this->wake();
+#endif
 #ifdef ESPHOME_LOG_HAS_VERBOSE
   ESP_LOGV(TAG, "Connection Params:");
   ESP_LOGV(TAG, "  SSID: '%s'", ap.get_ssid().c_str());
@@ -406,6 +426,9 @@ void WiFiComponent::enable() {
   this->error_from_callback_ = false;
   this->state_ = WIFI_COMPONENT_STATE_OFF;
   this->start();
+#ifdef USE_TICKLESS_LOOP
+  this->wake();
+#endif
 }
 
 void WiFiComponent::disable() {
@@ -459,6 +459,10 @@ const LogString *get_disconnect_reason_str(uint8_t reason) {
 }
 
 void WiFiComponent::wifi_event_callback(System_Event_t *event) {
+#ifdef USE_TICKLESS_LOOP
+  if (global_wifi_component != nullptr)
+    global_wifi_component->wake();
+#endif
   switch (event->event) {
     case EVENT_STAMODE_CONNECTED: {
       auto it = event->event_info.connected;
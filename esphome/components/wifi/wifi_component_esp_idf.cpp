@@ -116,6 +116,11 @@ void event_handler(void *arg, esp_event_base_t event_base, int32_t event_id, voi
   if (xQueueSend(s_event_queue, &to_send, 0L) != pdPASS) {
     delete to_send;  // NOLINT(cppcoreguidelines-owning-memory)
   }
+#ifdef USE_TICKLESS_LOOP
+  // the queue is processed by loop()
+  if (global_wifi_component != nullptr)
+    global_wifi_component->wake();
+#endif
 }
 
 void WiFiComponent::wifi_pre_setup_() {
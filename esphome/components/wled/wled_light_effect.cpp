@@ -24,16 +24,16 @@ const int DEFAULT_BLANK_TIME = 1000;
 
 static const char *const TAG = "wled_light_effect";
 
-WLEDLightEffect::WLEDLightEffect(const std::string &name) : AddressableLightEffect(name) {}
+WLEDLightEffect::WLEDLightEffect(const std::string &name) : AddressableStreamLightEffect(name) {}
 
 void WLEDLightEffect::start() {
-  AddressableLightEffect::start();
+  AddressableStreamLightEffect::start();
 
   blank_at_ = 0;
 }
 
 void WLEDLightEffect::stop() {
-  AddressableLightEffect::stop();
+  AddressableStreamLightEffect::stop();
 
   if (udp_) {
     udp_->stop();
@@ -41,13 +41,6 @@ void WLEDLightEffect::stop() {
   }
 }
 
-void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
-  for (int led = it.size(); led-- > 0;) {
-    it[led].set(Color::BLACK);
-  }
-  it.schedule_show();
-}
-
 void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
   // Init UDP lazily
   if (!udp_) {
@@ -59,20 +52,25 @@ void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_co
     }
   }
 
-  std::vector<uint8_t> payload;
+  // Drain all queued packets into the shared receive buffer, but only show the result once
+  bool received = false;
   while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
+    uint8_t *payload = get_buffer_(packet_size);
 
-    if (!udp_->read(&payload[0], payload.size())) {
+    if (!udp_->read(payload, packet_size)) {
       continue;
     }
 
-    if (!this->parse_frame_(it, &payload[0], payload.size())) {
-      ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload.size(), payload[0]);
+    if (!this->parse_frame_(it, payload, packet_size)) {
+      ESP_LOGD(TAG, "Frame: Invalid (size=%u, first=0x%02X).", packet_size, payload[0]);
       continue;
     }
+    received = true;
   }
 
+  if (received)
+    it.schedule_show();
+
   // FIXME: Use roll-over safe arithmetic
   if (blank_at_ < millis()) {
     blank_all_leds_(it);
@@ -138,7 +136,6 @@ bool WLEDLightEffect::parse_frame_(light::AddressableLight &it, const uint8_t *p
     blank_at_ = millis() + DEFAULT_BLANK_TIME;
   }
 
-  it.schedule_show();
   return true;
 }
 
@@ -176,19 +173,7 @@ bool WLEDLightEffect::parse_drgb_frame_(light::AddressableLight &it, const uint8
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 3) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
-
+  it.write_rgb(0, payload, size / 3);
   return true;
 }
 
@@ -198,20 +183,7 @@ bool WLEDLightEffect::parse_drgbw_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 4;
-  auto max_leds = it.size();
-
-  for (uint16_t led = 0; led < count; ++led, payload += 4) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-    uint8_t w = payload[3];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b, w));
-    }
-  }
-
+  it.write_rgbw(0, payload, size / 4);
   return true;
 }
 
@@ -230,19 +202,7 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
     return false;
   }
 
-  auto count = size / 3;
-  auto max_leds = it.size();
-
-  for (; count > 0; count--, payload += 3, led++) {
-    uint8_t r = payload[0];
-    uint8_t g = payload[1];
-    uint8_t b = payload[2];
-
-    if (led < max_leds) {
-      it[led].set(Color(r, g, b));
-    }
-  }
-
+  it.write_rgb(led, payload, size / 3);
   return true;
 }
 
@@ -5,7 +5,6 @@
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 
-#include <vector>
 #include <memory>
 
 class UDP;
@@ -13,7 +12,7 @@ class UDP;
 namespace esphome {
 namespace wled {
 
-class WLEDLightEffect : public light::AddressableLightEffect {
+class WLEDLightEffect : public light::AddressableStreamLightEffect {
  public:
   WLEDLightEffect(const std::string &name);
 
@@ -23,7 +22,6 @@ class WLEDLightEffect : public light::AddressableLightEffect {
   void set_port(uint16_t port) { this->port_ = port; }
 
  protected:
-  void blank_all_leds_(light::AddressableLight &it);
   bool parse_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_notifier_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_warls_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
@@ -7,10 +7,37 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#ifdef USE_TICKLESS_LOOP
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+#include "esphome/components/socket/headers.h"
+#endif
+#ifdef USE_HOST
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+#ifdef USE_ESP8266
+#include <coredecls.h>
+#endif
+#ifdef USE_RP2040
+#include <hardware/sync.h>
+#include <pico/time.h>
+#endif
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "app";
 
+#ifdef USE_TICKLESS_LOOP
+/// Upper bound for a single tickless sleep, so the watchdog is fed and millis() rollovers are noticed.
+static const uint32_t TICKLESS_MAX_SLEEP = 1000;
+/// While sockets are registered, ISR and task wakeups on platforms without a select()-able wake source are only
+/// noticed between select() calls of this length.
+static const uint32_t TICKLESS_SELECT_SLICE = 10;
+#endif
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -59,6 +86,10 @@ void Application::setup() {
     } while (!component->can_proceed());
   }
 
+#if defined(USE_TICKLESS_LOOP) && (defined(USE_ESP32) || defined(USE_LIBRETINY))
+  this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#endif
+
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
@@ -68,7 +99,21 @@ void Application::loop() {
 
   this->scheduler.call();
   this->feed_wdt();
+#ifdef USE_TICKLESS_LOOP
+  bool all_idle = true;
+#endif
   for (Component *component : this->looping_components_) {
+#ifdef USE_TICKLESS_LOOP
+    if (component->loop_idle_) {
+      if (!component->loop_wake_pending_) {
+        new_app_state |= component->get_component_state();
+        continue;
+      }
+      component->loop_idle_ = false;
+    }
+    // cleared before the call, so a wake during loop() leads to another call
+    component->loop_wake_pending_ = false;
+#endif
     {
       WarnIfComponentBlockingGuard guard{component};
       component->call();
@@ -76,6 +121,9 @@ void Application::loop() {
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
     this->feed_wdt();
+#ifdef USE_TICKLESS_LOOP
+    all_idle = all_idle && component->is_idle();
+#endif
   }
   this->app_state_ = new_app_state;
 
@@ -88,12 +136,28 @@ void Application::loop() {
     if (now - this->last_loop_ < this->loop_interval_)
       delay_time = this->loop_interval_ - (now - this->last_loop_);
 
-    uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
-    // next_schedule is max 0.5*delay_time
-    // otherwise interval=0 schedules result in constant looping with almost no sleep
-    next_schedule = std::max(next_schedule, delay_time / 2);
-    delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+#ifdef USE_TICKLESS_LOOP
+    bool can_sleep = all_idle && this->dump_config_at_ >= this->components_.size();
+#ifdef USE_STATUS_LED
+    // the status LED is blinked from feed_wdt(), which needs a running loop
+    if (status_led::global_status_led != nullptr && (this->app_state_ & STATUS_LED_MASK) != STATUS_LED_OK)
+      can_sleep = false;
+#endif
+    if (can_sleep) {
+      // Items added by components during this loop are not in the schedule yet.
+      this->scheduler.process_to_add();
+      delay_time = this->scheduler.next_schedule_in().value_or(TICKLESS_MAX_SLEEP);
+      delay_time = std::min(delay_time, TICKLESS_MAX_SLEEP);
+    } else
+#endif
+    {
+      uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
+      // next_schedule is max 0.5*delay_time
+      // otherwise interval=0 schedules result in constant looping with almost no sleep
+      next_schedule = std::max(next_schedule, delay_time / 2);
+      delay_time = std::min(next_schedule, delay_time);
+    }
+    this->wait_for_wake_(delay_time);
   }
   this->last_loop_ = now;
 
@@ -145,6 +209,152 @@ void Application::run_safe_shutdown_hooks() {
   }
 }
 
+void IRAM_ATTR HOT Application::wake_loop() {
+#ifdef USE_TICKLESS_LOOP
+  this->loop_wake_requested_ = true;
+#if defined(USE_ESP32)
+  if (this->loop_task_handle_ == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(this->loop_task_handle_, &higher_priority_task_woken);
+    if (higher_priority_task_woken)
+      portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(this->loop_task_handle_);
+  }
+#elif defined(USE_LIBRETINY)
+  if (this->loop_task_handle_ == nullptr)
+    return;
+  // There is no portable way to tell an ISR from a task here, the ISR variant is safe in both. Without a forced
+  // context switch the loop task runs at the next tick at the latest.
+  vTaskNotifyGiveFromISR(this->loop_task_handle_, nullptr);
+#elif defined(USE_ESP8266)
+  // resumes the loop task if it is suspended in delay()
+  esp_schedule();
+#elif defined(USE_RP2040)
+  __sev();
+#elif defined(USE_HOST)
+  if (this->wake_pipe_[1] != -1) {
+    const uint8_t byte = 0;
+    ::write(this->wake_pipe_[1], &byte, 1);
+  }
+#endif
+#endif  // USE_TICKLESS_LOOP
+}
+
+void Application::wait_for_wake_(uint32_t timeout) {
+#ifndef USE_TICKLESS_LOOP
+  delay(timeout);
+#else
+  const uint32_t start = millis();
+  while (!this->loop_wake_requested_) {
+    const uint32_t elapsed = millis() - start;
+    if (elapsed >= timeout)
+      break;
+    uint32_t remaining = timeout - elapsed;
+
+#if defined(USE_HOST)
+    if (this->wake_pipe_[0] == -1) {
+      if (::pipe(this->wake_pipe_) != 0)
+        break;
+      for (int fd : this->wake_pipe_)
+        ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+    }
+    fd_set read_fds;
+    FD_ZERO(&read_fds);
+    FD_SET(this->wake_pipe_[0], &read_fds);
+    int max_fd = this->wake_pipe_[0];
+    for (auto &sock : this->wake_sockets_) {
+      FD_SET(sock.fd, &read_fds);
+      max_fd = std::max(max_fd, sock.fd);
+    }
+    struct timeval tv;
+    tv.tv_sec = remaining / 1000;
+    tv.tv_usec = (remaining % 1000) * 1000;
+    int ret = ::select(max_fd + 1, &read_fds, nullptr, nullptr, &tv);
+    if (ret < 0 && errno != EINTR) {
+      // e.g. a socket was closed without being unregistered, sleep instead of retrying immediately
+      delay(remaining);
+      break;
+    }
+    if (ret <= 0)
+      continue;
+    if (FD_ISSET(this->wake_pipe_[0], &read_fds)) {
+      uint8_t buf[16];
+      while (::read(this->wake_pipe_[0], buf, sizeof(buf)) > 0) {
+      }
+    }
+    for (auto &sock : this->wake_sockets_) {
+      if (FD_ISSET(sock.fd, &read_fds))
+        sock.component->wake();
+    }
+#else
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+    if (!this->wake_sockets_.empty()) {
+      // Sockets can't be woken from an ISR, so wait on them in slices and check for other wakes in between.
+      remaining = std::min(remaining, TICKLESS_SELECT_SLICE);
+      fd_set read_fds;
+      FD_ZERO(&read_fds);
+      int max_fd = -1;
+      for (auto &sock : this->wake_sockets_) {
+        FD_SET(sock.fd, &read_fds);
+        max_fd = std::max(max_fd, sock.fd);
+      }
+      struct timeval tv;
+      tv.tv_sec = 0;
+      tv.tv_usec = remaining * 1000;
+#ifdef USE_SOCKET_IMPL_LWIP_SOCKETS
+      int ret = lwip_select(max_fd + 1, &read_fds, nullptr, nullptr, &tv);
+#else
+      int ret = ::select(max_fd + 1, &read_fds, nullptr, nullptr, &tv);
+#endif
+      if (ret > 0) {
+        for (auto &sock : this->wake_sockets_) {
+          if (FD_ISSET(sock.fd, &read_fds))
+            sock.component->wake();
+        }
+      }
+      if (ret >= 0) {
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+        // select() waited for the whole slice or a socket woke the loop, any notification is covered by the flag
+        ulTaskNotifyTake(pdTRUE, 0);
+#endif
+        continue;
+      }
+      // select() failed and returned immediately, wait on the other wake sources for this slice instead
+    }
+#endif
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+    // pdMS_TO_TICKS() rounds sub-tick waits down to 0, which would not block at all
+    ulTaskNotifyTake(pdTRUE, std::max<TickType_t>(pdMS_TO_TICKS(remaining), 1));
+#elif defined(USE_ESP8266)
+    // delay() suspends the loop task until its timer fires, or until esp_schedule() is called by wake_loop()
+    delay(remaining);
+#elif defined(USE_RP2040)
+    // sleeps until __sev() from wake_loop(), an interrupt or the timeout
+    best_effort_wfe_or_timeout(make_timeout_time_ms(remaining));
+#else
+    delay(1);
+#endif
+#endif
+  }
+  this->loop_wake_requested_ = false;
+#endif  // USE_TICKLESS_LOOP
+}
+
+#if defined(USE_TICKLESS_LOOP) && (defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS))
+void Application::register_wake_socket(int fd, Component *component) {
+  this->unregister_wake_socket(fd);
+  this->wake_sockets_.push_back(WakeSocket{fd, component});
+}
+void Application::unregister_wake_socket(int fd) {
+  this->wake_sockets_.erase(std::remove_if(this->wake_sockets_.begin(), this->wake_sockets_.end(),
+                                           [fd](const WakeSocket &sock) { return sock.fd == fd; }),
+                            this->wake_sockets_.end());
+}
+#endif
+
 void Application::calculate_looping_components_() {
   for (auto *obj : this->components_) {
     if (obj->has_overridden_loop())
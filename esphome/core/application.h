@@ -9,6 +9,16 @@
 #include "esphome/core/preferences.h"
 #include "esphome/core/scheduler.h"
 
+#ifdef USE_TICKLESS_LOOP
+#if defined(USE_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#elif defined(USE_LIBRETINY)
+#include <FreeRTOS.h>
+#include <task.h>
+#endif
+#endif
+
 #ifdef USE_BINARY_SENSOR
 #include "esphome/components/binary_sensor/binary_sensor.h"
 #endif
@@ -177,6 +187,19 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake the main loop if it is sleeping in tickless mode.
+   *
+   * Safe to call from ISRs and other tasks. Components should usually call Component::wake() instead, which also
+   * makes sure their loop() is called.
+   */
+  void wake_loop();
+
+#if defined(USE_TICKLESS_LOOP) && (defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS))
+  /// Wake \p component whenever socket \p fd becomes readable while the main loop is sleeping.
+  void register_wake_socket(int fd, Component *component);
+  void unregister_wake_socket(int fd);
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -187,6 +210,8 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
@@ -328,6 +353,9 @@ class Application {
 
   void feed_wdt_arch_();
 
+  /// Sleep for up to \p timeout ms, returning early when wake_loop() is called.
+  void wait_for_wake_(uint32_t timeout);
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
@@ -383,6 +411,23 @@ class Application {
   uint32_t loop_interval_{16};
   size_t dump_config_at_{SIZE_MAX};
   uint32_t app_state_{0};
+
+#ifdef USE_TICKLESS_LOOP
+  volatile bool loop_wake_requested_{false};
+#if defined(USE_ESP32) || defined(USE_LIBRETINY)
+  TaskHandle_t loop_task_handle_{nullptr};
+#endif
+#ifdef USE_HOST
+  int wake_pipe_[2]{-1, -1};
+#endif
+#if defined(USE_SOCKET_IMPL_BSD_SOCKETS) || defined(USE_SOCKET_IMPL_LWIP_SOCKETS)
+  struct WakeSocket {
+    int fd;
+    Component *component;
+  };
+  std::vector<WakeSocket> wake_sockets_{};
+#endif
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
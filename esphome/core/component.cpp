@@ -6,6 +6,10 @@
 #include "esphome/core/log.h"
 #include <utility>
 
+#ifdef USE_PROFILER
+#include "esphome/components/profiler/profiler.h"
+#endif
+
 namespace esphome {
 
 static const char *const TAG = "component";
@@ -56,6 +60,14 @@ bool Component::cancel_interval(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_interval(this, name);
 }
 
+void Component::set_interval(const char *name, uint32_t interval, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_interval(this, name, interval, std::move(f));
+}
+
+bool Component::cancel_interval(const char *name) {  // NOLINT
+  return App.scheduler.cancel_interval(this, name);
+}
+
 void Component::set_retry(const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                           std::function<RetryResult(uint8_t)> &&f, float backoff_increase_factor) {  // NOLINT
   App.scheduler.set_retry(this, name, initial_wait_time, max_attempts, std::move(f), backoff_increase_factor);
@@ -73,6 +85,14 @@ bool Component::cancel_timeout(const std::string &name) {  // NOLINT
   return App.scheduler.cancel_timeout(this, name);
 }
 
+void Component::set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, timeout, std::move(f));
+}
+
+bool Component::cancel_timeout(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+
 void Component::call_loop() { this->loop(); }
 void Component::call_setup() { this->setup(); }
 void Component::call_dump_config() { this->dump_config(); }
@@ -124,6 +144,12 @@ bool Component::cancel_defer(const std::string &name) {  // NOLINT
 void Component::defer(const std::string &name, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, name, 0, std::move(f));
 }
+bool Component::cancel_defer(const char *name) {  // NOLINT
+  return App.scheduler.cancel_timeout(this, name);
+}
+void Component::defer(const char *name, std::function<void()> &&f) {  // NOLINT
+  App.scheduler.set_timeout(this, name, 0, std::move(f));
+}
 void Component::set_timeout(uint32_t timeout, std::function<void()> &&f) {  // NOLINT
   App.scheduler.set_timeout(this, "", timeout, std::move(f));
 }
@@ -160,6 +186,14 @@ void Component::status_momentary_error(const std::string &name, uint32_t length)
   this->status_set_error();
   this->set_timeout(name, length, [this]() { this->status_clear_error(); });
 }
+void Component::status_momentary_warning(const char *name, uint32_t length) {
+  this->status_set_warning();
+  this->set_timeout(name, length, [this]() { this->status_clear_warning(); });
+}
+void Component::status_momentary_error(const char *name, uint32_t length) {
+  this->status_set_error();
+  this->set_timeout(name, length, [this]() { this->status_clear_error(); });
+}
 void Component::dump_config() {}
 float Component::get_actual_setup_priority() const {
   if (std::isnan(this->setup_priority_override_))
@@ -182,6 +216,25 @@ bool Component::has_overridden_loop() const {
   return loop_overridden || call_loop_overridden;
 }
 
+void Component::idle() {
+#ifdef USE_TICKLESS_LOOP
+  this->loop_idle_ = true;
+#endif
+}
+void IRAM_ATTR HOT Component::wake() {
+#ifdef USE_TICKLESS_LOOP
+  this->loop_wake_pending_ = true;
+  App.wake_loop();
+#endif
+}
+bool Component::is_idle() const {
+#ifdef USE_TICKLESS_LOOP
+  return this->loop_idle_ && !this->loop_wake_pending_;
+#else
+  return false;
+#endif
+}
+
 PollingComponent::PollingComponent(uint32_t update_interval) : update_interval_(update_interval) {}
 
 void PollingComponent::call_setup() {
@@ -195,9 +248,23 @@ void PollingComponent::call_setup() {
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+#ifdef USE_PROFILER
 WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
+    : started_(millis()), component_(component), started_us_(micros()), name_hash_(0), scheduler_(false) {}
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t name_hash)
+    : started_(millis()), component_(component), started_us_(micros()), name_hash_(name_hash), scheduler_(true) {}
+#else
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component)
+    : started_(millis()), component_(component) {}
+WarnIfComponentBlockingGuard::WarnIfComponentBlockingGuard(Component *component, uint32_t name_hash)
     : started_(millis()), component_(component) {}
+#endif
 WarnIfComponentBlockingGuard::~WarnIfComponentBlockingGuard() {
+#ifdef USE_PROFILER
+  if (profiler::global_profiler != nullptr)
+    profiler::global_profiler->record(this->component_, this->scheduler_, this->name_hash_,
+                                      micros() - this->started_us_);
+#endif
   uint32_t now = millis();
   if (now - started_ > 50) {
     const char *src = component_ == nullptr ? "<null>" : component_->get_component_source();
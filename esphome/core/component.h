@@ -4,6 +4,7 @@
 #include <functional>
 #include <cmath>
 
+#include "esphome/core/defines.h"
 #include "esphome/core/optional.h"
 
 namespace esphome {
@@ -42,6 +43,8 @@ extern const float LATE;
 }  // namespace setup_priority
 
 static const uint32_t SCHEDULER_DONT_RUN = 4294967295UL;
+/// Name hash of scheduler items without a name (the FNV-1 hash of an empty string), these can't be cancelled.
+static const uint32_t SCHEDULER_NO_NAME = 2166136261UL;
 
 #define LOG_UPDATE_INTERVAL(this) \
   if (this->get_update_interval() == SCHEDULER_DONT_RUN) { \
@@ -136,11 +139,22 @@ class Component {
   void status_clear_error();
 
   void status_momentary_warning(const std::string &name, uint32_t length = 5000);
+  void status_momentary_warning(const char *name, uint32_t length = 5000);
 
   void status_momentary_error(const std::string &name, uint32_t length = 5000);
+  void status_momentary_error(const char *name, uint32_t length = 5000);
 
   bool has_overridden_loop() const;
 
+  /** Request a call of loop() from an idle component, see idle().
+   *
+   * Safe to call from ISRs and other tasks. Multiple wakes before the next loop() call are coalesced.
+   */
+  void wake();
+
+  /// Whether this component has called idle() and was not woken up since.
+  bool is_idle() const;
+
   /** Set where this component was loaded from for some debug messages.
    *
    * This is set by the ESPHome core, and should not be called manually.
@@ -159,6 +173,15 @@ class Component {
   virtual void call_setup();
   virtual void call_dump_config();
 
+  /** Stop calling loop() until wake() is called.
+   *
+   * Only has an effect with the tickless main loop (`tickless_loop: true`). Components call this from loop() once
+   * they have no more work, and must make sure every event they wait for (interrupt, socket data, scheduler callback,
+   * ...) calls wake(). When all looping components are idle, the main loop sleeps until the next wake or scheduler
+   * deadline instead of polling.
+   */
+  void idle();
+
   /** Set an interval function with a unique name. Empty name means no cancelling possible.
    *
    * This will call f every interval ms. Can be cancelled via CancelInterval().
@@ -176,6 +199,9 @@ class Component {
    */
   void set_interval(const std::string &name, uint32_t interval, std::function<void()> &&f);  // NOLINT
 
+  /// Same as above for string literals: \p name must outlive the item, the scheduler only keeps a pointer to it.
+  void set_interval(const char *name, uint32_t interval, std::function<void()> &&f);  // NOLINT
+
   void set_interval(uint32_t interval, std::function<void()> &&f);  // NOLINT
 
   /** Cancel an interval function.
@@ -184,6 +210,7 @@ class Component {
    * @return Whether an interval functions was deleted.
    */
   bool cancel_interval(const std::string &name);  // NOLINT
+  bool cancel_interval(const char *name);         // NOLINT
 
   /** Set an retry function with a unique name. Empty name means no cancelling possible.
    *
@@ -244,6 +271,9 @@ class Component {
    */
   void set_timeout(const std::string &name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
+  /// Same as above for string literals: \p name must outlive the item, the scheduler only keeps a pointer to it.
+  void set_timeout(const char *name, uint32_t timeout, std::function<void()> &&f);  // NOLINT
+
   void set_timeout(uint32_t timeout, std::function<void()> &&f);  // NOLINT
 
   /** Cancel a timeout function.
@@ -252,6 +282,7 @@ class Component {
    * @return Whether a timeout functions was deleted.
    */
   bool cancel_timeout(const std::string &name);  // NOLINT
+  bool cancel_timeout(const char *name);         // NOLINT
 
   /** Defer a callback to the next loop() call.
    *
@@ -261,16 +292,22 @@ class Component {
    * @param f The callback.
    */
   void defer(const std::string &name, std::function<void()> &&f);  // NOLINT
+  void defer(const char *name, std::function<void()> &&f);         // NOLINT
 
   /// Defer a callback to the next loop() call.
   void defer(std::function<void()> &&f);  // NOLINT
 
   /// Cancel a defer callback using the specified name, name must not be empty.
   bool cancel_defer(const std::string &name);  // NOLINT
+  bool cancel_defer(const char *name);         // NOLINT
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
   const char *component_source_{nullptr};
+#ifdef USE_TICKLESS_LOOP
+  bool loop_idle_{false};
+  volatile bool loop_wake_pending_{false};
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -314,12 +351,20 @@ class PollingComponent : public Component {
 
 class WarnIfComponentBlockingGuard {
  public:
+  /// Guard a call of \p component's loop().
   WarnIfComponentBlockingGuard(Component *component);
+  /// Guard a call of the scheduler item \p name_hash of \p component.
+  WarnIfComponentBlockingGuard(Component *component, uint32_t name_hash);
   ~WarnIfComponentBlockingGuard();
 
  protected:
   uint32_t started_;
   Component *component_;
+#ifdef USE_PROFILER
+  uint32_t started_us_;
+  uint32_t name_hash_;
+  bool scheduler_;
+#endif
 };
 
 }  // namespace esphome
@@ -55,6 +55,11 @@ LoopTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_SCHEDULER = "scheduler"
+CONF_TICKLESS_LOOP = "tickless_loop"
+
+SCHEDULER_HEAP = "heap"
+SCHEDULER_TIMER_WHEEL = "timer_wheel"
 
 
 VALID_INCLUDE_EXTS = {".h", ".hpp", ".tcc", ".ino", ".cpp", ".c"}
@@ -153,6 +158,10 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
             cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
             cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+            cv.Optional(CONF_SCHEDULER, default=SCHEDULER_HEAP): cv.one_of(
+                SCHEDULER_HEAP, SCHEDULER_TIMER_WHEEL, lower=True
+            ),
+            cv.Optional(CONF_TICKLESS_LOOP, default=False): cv.boolean,
             cv.Optional(CONF_PROJECT): cv.Schema(
                 {
                     cv.Required(CONF_NAME): cv.All(
@@ -390,5 +399,10 @@ async def to_code(config):
         cg.add_define("ESPHOME_PROJECT_NAME", config[CONF_PROJECT][CONF_NAME])
         cg.add_define("ESPHOME_PROJECT_VERSION", config[CONF_PROJECT][CONF_VERSION])
 
+    if config[CONF_SCHEDULER] == SCHEDULER_TIMER_WHEEL:
+        cg.add_define("USE_SCHEDULER_TIMER_WHEEL")
+    if config[CONF_TICKLESS_LOOP]:
+        cg.add_define("USE_TICKLESS_LOOP")
+
     if config[CONF_PLATFORMIO_OPTIONS]:
         CORE.add_job(_add_platformio_options, config[CONF_PLATFORMIO_OPTIONS])
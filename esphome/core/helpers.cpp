@@ -67,6 +67,11 @@ static const uint16_t CRC16_1021_BE_LUT_L[] = {0x0000, 0x1021, 0x2042, 0x3063, 0
 static const uint16_t CRC16_1021_BE_LUT_H[] = {0x0000, 0x1231, 0x2462, 0x3653, 0x48c4, 0x5af5, 0x6ca6, 0x7e97,
                                                0x9188, 0x83b9, 0xb5ea, 0xa7db, 0xd94c, 0xcb7d, 0xfd2e, 0xef1f};
 #endif
+#ifndef USE_ESP32
+static const uint32_t CRC32_EDB88320_LE_LUT[] = {0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4,
+                                                 0x4db26158, 0x5005713c, 0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c,
+                                                 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c};
+#endif
 
 // STL backports
 
@@ -173,6 +178,20 @@ uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc, uint16_t poly,
   return refout ? (crc ^ 0xffff) : crc;
 }
 
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc) {
+#ifdef USE_ESP32
+  return crc32_le(crc, data, len);
+#else
+  crc ^= 0xffffffff;
+  while (len--) {
+    crc ^= *data++;
+    crc = (crc >> 4) ^ CRC32_EDB88320_LE_LUT[crc & 0x0F];
+    crc = (crc >> 4) ^ CRC32_EDB88320_LE_LUT[crc & 0x0F];
+  }
+  return crc ^ 0xffffffff;
+#endif
+}
+
 uint32_t fnv1_hash(const std::string &str) {
   uint32_t hash = 2166136261UL;
   for (char c : str) {
@@ -162,9 +162,20 @@ uint16_t crc16(const uint8_t *data, uint16_t len, uint16_t crc = 0xffff, uint16_
                bool refin = false, bool refout = false);
 uint16_t crc16be(const uint8_t *data, uint16_t len, uint16_t crc = 0, uint16_t poly = 0x1021, bool refin = false,
                  bool refout = false);
+/// Calculate a CRC-32 (IEEE 802.3) checksum of \p data with size \p len, continuing from \p crc.
+uint32_t crc32(const uint8_t *data, size_t len, uint32_t crc = 0);
 
 /// Calculate a FNV-1 hash of \p str.
 uint32_t fnv1_hash(const std::string &str);
+/// Calculate a FNV-1 hash of the null-terminated string \p str (at compile time when possible).
+constexpr14 uint32_t fnv1_hash(const char *str) {
+  uint32_t hash = 2166136261UL;
+  for (; *str != '\0'; str++) {
+    hash *= 16777619UL;
+    hash ^= *str;
+  }
+  return hash;
+}
 
 /// Return a random 32-bit unsigned integer.
 uint32_t random_uint32();
@@ -0,0 +1,114 @@
+#include "esphome/core/preference_cache.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+
+static const size_t PREFERENCE_CACHE_INITIAL_SLOTS = 16;
+
+bool PreferenceWriteBudget::consume(uint32_t count) {
+  if (this->max_writes_ == 0)
+    return true;
+  const uint32_t now = millis();
+  if (now - this->window_start_ >= this->window_ms_) {
+    this->window_start_ = now;
+    this->used_ = 0;
+  }
+  if (this->used_ + count > this->max_writes_)
+    return false;
+  this->used_ += count;
+  return true;
+}
+
+size_t PreferenceCache::probe_(uint32_t type) const {
+  const size_t mask = this->slots_.size() - 1;
+  // types are usually hashes already, but spread sequential ones anyway
+  uint32_t hash = type * 2654435769UL;
+  hash ^= hash >> 16;
+  size_t index = hash & mask;
+  while (this->slots_[index].used && this->slots_[index].type != type)
+    index = (index + 1) & mask;
+  return index;
+}
+
+void PreferenceCache::grow_() {
+  std::vector<Entry> old;
+  old.swap(this->slots_);
+  this->slots_.resize(old.empty() ? PREFERENCE_CACHE_INITIAL_SLOTS : old.size() * 2);
+  for (auto &entry : old) {
+    if (entry.used)
+      this->slots_[this->probe_(entry.type)] = std::move(entry);
+  }
+}
+
+PreferenceCache::Entry &PreferenceCache::find_or_insert_(uint32_t type) {
+  // keep the load factor below 3/4
+  if ((this->used_count_ + 1) * 4 > this->slots_.size() * 3)
+    this->grow_();
+  Entry &entry = this->slots_[this->probe_(type)];
+  if (!entry.used) {
+    entry.used = true;
+    entry.type = type;
+    entry.pending = false;
+    entry.stored_crc_valid = false;
+    this->used_count_++;
+  }
+  return entry;
+}
+
+void PreferenceCache::save(uint32_t type, const uint8_t *data, size_t len) {
+  Entry &entry = this->find_or_insert_(type);
+  entry.data.assign(data, data + len);
+  if (!entry.pending) {
+    entry.pending = true;
+    this->pending_count_++;
+  }
+}
+
+const std::vector<uint8_t> *PreferenceCache::get_pending(uint32_t type) const {
+  if (this->pending_count_ == 0)
+    return nullptr;
+  const Entry &entry = this->slots_[this->probe_(type)];
+  if (!entry.used || !entry.pending)
+    return nullptr;
+  return &entry.data;
+}
+
+void PreferenceCache::set_stored(uint32_t type, const uint8_t *data, size_t len) {
+  Entry &entry = this->find_or_insert_(type);
+  entry.stored_crc = crc32(data, len);
+  entry.stored_crc_valid = true;
+}
+
+bool PreferenceCache::is_unchanged(const Entry &entry) const {
+  return entry.stored_crc_valid && entry.stored_crc == crc32(entry.data.data(), entry.data.size());
+}
+
+void PreferenceCache::mark_synced(Entry &entry) {
+  if (!entry.pending)
+    return;
+  entry.stored_crc = crc32(entry.data.data(), entry.data.size());
+  entry.stored_crc_valid = true;
+  entry.pending = false;
+  // release the memory, the value is in flash now
+  std::vector<uint8_t>().swap(entry.data);
+  this->pending_count_--;
+}
+
+std::vector<PreferenceCache::Entry *> PreferenceCache::get_pending_entries() {
+  std::vector<Entry *> ret;
+  ret.reserve(this->pending_count_);
+  for (auto &entry : this->slots_) {
+    if (entry.used && entry.pending)
+      ret.push_back(&entry);
+  }
+  return ret;
+}
+
+void PreferenceCache::clear() {
+  this->slots_.clear();
+  this->used_count_ = 0;
+  this->pending_count_ = 0;
+}
+
+}  // namespace esphome
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+
+/// Limits how many flash writes preferences do per time window, to bound flash wear.
+class PreferenceWriteBudget {
+ public:
+  /// Allow \p max_writes writes per \p window_ms milliseconds. 0 disables the limit.
+  void set(uint32_t max_writes, uint32_t window_ms) {
+    this->max_writes_ = max_writes;
+    this->window_ms_ = window_ms;
+  }
+
+  /// Take \p count writes from the budget. Returns false (and takes nothing) if the current window has too few left.
+  bool consume(uint32_t count = 1);
+
+ protected:
+  uint32_t max_writes_{0};
+  uint32_t window_ms_{0};
+  uint32_t window_start_{0};
+  uint32_t used_{0};
+};
+
+/** Pending preference writes of the flash backends, keyed by preference type.
+ *
+ * save() only queues values in RAM, the backend writes them in sync(). Per type, the cache remembers a CRC-32 of the
+ * value known to be in flash, so unchanged values can be dropped in sync() without reading flash back.
+ *
+ * The entries are kept in an open-addressed hash table with linear probing. Entries are never removed (there is one per
+ * preference type at most), synced entries only release their data.
+ */
+class PreferenceCache {
+ public:
+  struct Entry {
+    uint32_t type;
+    /// CRC-32 of the value in flash, only valid if `stored_crc_valid` is set.
+    uint32_t stored_crc;
+    bool used;
+    bool pending;
+    bool stored_crc_valid;
+    /// The value to write, only set while `pending`.
+    std::vector<uint8_t> data;
+  };
+
+  /// Queue \p data as the new value of \p type, replacing a previously queued value.
+  void save(uint32_t type, const uint8_t *data, size_t len);
+
+  /// The queued value of \p type, or nullptr if there is none.
+  const std::vector<uint8_t> *get_pending(uint32_t type) const;
+
+  /// Remember that \p data is the value of \p type in flash, for example after reading it.
+  void set_stored(uint32_t type, const uint8_t *data, size_t len);
+
+  /// Whether the pending value of \p entry is known to match flash.
+  bool is_unchanged(const Entry &entry) const;
+
+  /// Mark the pending value of \p entry as written to flash.
+  void mark_synced(Entry &entry);
+
+  /// All entries with a queued value.
+  std::vector<Entry *> get_pending_entries();
+
+  size_t pending_count() const { return this->pending_count_; }
+  bool empty() const { return this->pending_count_ == 0; }
+
+  /// Forget all queued values and stored CRCs.
+  void clear();
+
+ protected:
+  /// Index of the slot of \p type, or of the empty slot where it would be inserted. Requires a non-full table.
+  size_t probe_(uint32_t type) const;
+  Entry &find_or_insert_(uint32_t type);
+  void grow_();
+
+  std::vector<Entry> slots_;
+  size_t used_count_{0};
+  size_t pending_count_{0};
+};
+
+}  // namespace esphome
@@ -46,6 +46,19 @@ class ESPPreferences {
    */
   virtual bool sync() = 0;
 
+  /**
+   * Commit pending writes to flash, as far as the write budget allows. The remaining writes stay pending.
+   *
+   * @return true if no write failed.
+   */
+  virtual bool sync_within_budget() { return this->sync(); }
+
+  /**
+   * Limit the number of flash writes sync_within_budget() does to \p max_writes per \p window_ms milliseconds.
+   * 0 disables the limit. sync() always writes everything, for example before a restart.
+   */
+  virtual void set_write_budget(uint32_t max_writes, uint32_t window_ms) {}
+
   /**
    * Forget all unsaved changes and re-initialize the permanent preferences storage.
    * Usually followed by a restart which moves the system to "factory" conditions
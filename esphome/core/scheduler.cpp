@@ -4,6 +4,7 @@
 #include "esphome/core/hal.h"
 #include <algorithm>
 #include <cinttypes>
+#include <cstring>
 
 namespace esphome {
 
@@ -21,63 +22,80 @@ static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> func) {
-  const uint32_t now = this->millis_();
-
-  if (!name.empty())
-    this->cancel_timeout(component, name);
-
-  if (timeout == SCHEDULER_DONT_RUN)
-    return;
-
-  ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name.c_str(), timeout);
-
-  auto item = make_unique<SchedulerItem>();
-  item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
-  item->callback = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  this->set_timer_(component, SchedulerItem::TIMEOUT, name.c_str(), true, timeout, std::move(func));
+}
+void HOT Scheduler::set_timeout(Component *component, const char *name, uint32_t timeout,
+                                std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::TIMEOUT, name, false, timeout, std::move(func));
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
+  return this->cancel_item_(component, name.c_str(), SchedulerItem::TIMEOUT);
+}
+bool HOT Scheduler::cancel_timeout(Component *component, const char *name) {
   return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::INTERVAL, name.c_str(), true, interval, std::move(func));
+}
+void HOT Scheduler::set_interval(Component *component, const char *name, uint32_t interval,
+                                 std::function<void()> func) {
+  this->set_timer_(component, SchedulerItem::INTERVAL, name, false, interval, std::move(func));
+}
+bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
+  return this->cancel_item_(component, name.c_str(), SchedulerItem::INTERVAL);
+}
+bool HOT Scheduler::cancel_interval(Component *component, const char *name) {
+  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
+}
+const char *Scheduler::copy_name_(const char *name) {
+  const size_t size = strlen(name) + 1;
+  char *copy = new char[size];  // NOLINT(cppcoreguidelines-owning-memory)
+  memcpy(copy, name, size);
+  return copy;
+}
+
+#ifndef USE_SCHEDULER_TIMER_WHEEL
+void HOT Scheduler::set_timer_(Component *component, SchedulerItem::Type type, const char *name, bool copy_name,
+                               uint32_t delay, std::function<void()> func) {
   const uint32_t now = this->millis_();
 
-  if (!name.empty())
-    this->cancel_interval(component, name);
+  if (name == nullptr || *name == '\0') {
+    name = "";
+    copy_name = false;
+  } else {
+    this->cancel_item_(component, name, type);
+  }
 
-  if (interval == SCHEDULER_DONT_RUN)
+  if (delay == SCHEDULER_DONT_RUN)
     return;
 
-  // only put offset in lower half
-  uint32_t offset = 0;
-  if (interval != 0)
-    offset = (random_uint32() % interval) / 2;
-
-  ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name.c_str(), interval, offset);
-
   auto item = make_unique<SchedulerItem>();
   item->component = component;
-  item->name = name;
-  item->type = SchedulerItem::INTERVAL;
-  item->interval = interval;
-  item->last_execution = now - offset - interval;
+  item->set_name(copy_name ? copy_name_(name) : name, copy_name);
+  item->type = type;
+  item->interval = delay;
   item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
+  if (type == SchedulerItem::TIMEOUT) {
+    ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name, delay);
+    item->last_execution = now;
+  } else {
+    // only put offset in lower half
+    uint32_t offset = 0;
+    if (delay != 0)
+      offset = (random_uint32() % delay) / 2;
+
+    ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name, delay, offset);
+
+    item->last_execution = now - offset - delay;
+    if (item->last_execution > now)
+      item->last_execution_major--;
+  }
   item->callback = std::move(func);
   item->remove = false;
   this->push_(std::move(item));
 }
-bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
-  return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
-}
+#endif  // USE_SCHEDULER_TIMER_WHEEL
 
 struct RetryArgs {
   std::function<RetryResult(uint8_t)> func;
@@ -94,7 +112,8 @@ static void retry_handler(const std::shared_ptr<RetryArgs> &args) {
   if (retry_result == RetryResult::DONE || args->retry_countdown <= 0)
     return;
   // second execution of `func` happens after `initial_wait_time`
-  args->scheduler->set_timeout(args->component, args->name, args->current_interval, [args]() { retry_handler(args); });
+  args->scheduler->set_timeout(args->component, args->name, args->current_interval,
+                               [args]() { retry_handler(args); });
   // backoff_increase_factor applied to third & later executions
   args->current_interval *= args->backoff_increase_factor;
 }
@@ -134,6 +153,7 @@ bool HOT Scheduler::cancel_retry(Component *component, const std::string &name)
   return this->cancel_timeout(component, "retry$" + name);
 }
 
+#ifndef USE_SCHEDULER_TIMER_WHEEL
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
   if (this->empty_())
     return {};
@@ -162,7 +182,7 @@ void HOT Scheduler::call() {
       this->lock_.unlock();
 
       ESP_LOGVV(TAG, "  %s '%s' interval=%" PRIu32 " last_execution=%" PRIu32 " (%u) next=%" PRIu32 " (%u)",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution,
+                item->get_type_str(), item->name, item->interval, item->last_execution,
                 item->last_execution_major, item->next_execution(), item->next_execution_major());
 
       old_items.push_back(std::move(item));
@@ -223,14 +243,14 @@ void HOT Scheduler::call() {
 
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
       ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " last_execution=%" PRIu32 " (now=%" PRIu32 ")",
-                item->get_type_str(), item->name.c_str(), item->interval, item->last_execution, now);
+                item->get_type_str(), item->name, item->interval, item->last_execution, now);
 #endif
 
       // Warning: During callback(), a lot of stuff can happen, including:
       //  - timeouts/intervals get added, potentially invalidating vector pointers
       //  - timeouts/intervals get cancelled
       {
-        WarnIfComponentBlockingGuard guard{item->component};
+        WarnIfComponentBlockingGuard guard{item->component, item->name_hash};
         item->callback();
       }
     }
@@ -302,19 +322,23 @@ void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) {
   LockGuard guard{this->lock_};
   this->to_add_.push_back(std::move(item));
 }
-bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+bool HOT Scheduler::cancel_item_(Component *component, const char *name, Scheduler::SchedulerItem::Type type) {
+  // unnamed items can't be cancelled
+  if (name == nullptr || *name == '\0')
+    return false;
+  const uint32_t name_hash = fnv1_hash(name);
   // obtain lock because this function iterates and can be called from non-loop task context
   LockGuard guard{this->lock_};
   bool ret = false;
   for (auto &it : this->items_) {
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
+    if (it->matches(component, name, name_hash, type) && !it->remove) {
       to_remove_++;
       it->remove = true;
       ret = true;
     }
   }
   for (auto &it : this->to_add_) {
-    if (it->component == component && it->name == name && it->type == type) {
+    if (it->matches(component, name, name_hash, type)) {
       it->remove = true;
       ret = true;
     }
@@ -360,5 +384,6 @@ bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
 
   return a_next_exec > b_next_exec;
 }
+#endif  // USE_SCHEDULER_TIMER_WHEEL
 
 }  // namespace esphome
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <memory>
+#include <cstring>
 
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
@@ -12,11 +13,26 @@ class Component;
 
 class Scheduler {
  public:
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  Scheduler();
+#endif
+
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> func);
   bool cancel_timeout(Component *component, const std::string &name);
   void set_interval(Component *component, const std::string &name, uint32_t interval, std::function<void()> func);
   bool cancel_interval(Component *component, const std::string &name);
 
+  /** Variants of the above for names with static storage duration, i.e. string literals.
+   *
+   * Items keep a pointer to \p name instead of a copy, so it must stay valid until the item has run or was cancelled.
+   * Items are looked up by the FNV-1 hash of their name (see fnv1_hash()), names are only compared on a hash match.
+   * An empty name (or nullptr) means the item can't be cancelled.
+   */
+  void set_timeout(Component *component, const char *name, uint32_t timeout, std::function<void()> func);
+  bool cancel_timeout(Component *component, const char *name);
+  void set_interval(Component *component, const char *name, uint32_t interval, std::function<void()> func);
+  bool cancel_interval(Component *component, const char *name);
+
   void set_retry(Component *component, const std::string &name, uint32_t initial_wait_time, uint8_t max_attempts,
                  std::function<RetryResult(uint8_t)> func, float backoff_increase_factor = 1.0f);
   bool cancel_retry(Component *component, const std::string &name);
@@ -28,9 +44,15 @@ class Scheduler {
   void process_to_add();
 
  protected:
+  /// Copy of a name passed as std::string, which may not outlive the item.
+  static const char *copy_name_(const char *name);
+
+#ifndef USE_SCHEDULER_TIMER_WHEEL
   struct SchedulerItem {
     Component *component;
-    std::string name;
+    /// Either a string with static storage duration or, if name_is_dynamic, a copy owned by this item.
+    const char *name{""};
+    uint32_t name_hash{SCHEDULER_NO_NAME};
     enum Type { TIMEOUT, INTERVAL } type;
     union {
       uint32_t interval;
@@ -40,6 +62,25 @@ class Scheduler {
     std::function<void()> callback;
     bool remove;
     uint8_t last_execution_major;
+    bool name_is_dynamic{false};
+
+    SchedulerItem() = default;
+    SchedulerItem(const SchedulerItem &) = delete;
+    SchedulerItem &operator=(const SchedulerItem &) = delete;
+    ~SchedulerItem() { this->set_name("", false); }
+
+    bool matches(Component *component, const char *name, uint32_t name_hash, Type type) const {
+      return this->component == component && this->name_hash == name_hash && this->type == type &&
+             strcmp(this->name, name) == 0;
+    }
+    /// Take \p name, and ownership of it if \p is_dynamic, releasing the previous name.
+    void set_name(const char *name, bool is_dynamic) {
+      if (this->name_is_dynamic)
+        delete[] this->name;  // NOLINT(cppcoreguidelines-owning-memory)
+      this->name = name;
+      this->name_hash = fnv1_hash(name);
+      this->name_is_dynamic = is_dynamic;
+    }
 
     inline uint32_t next_execution() { return this->last_execution + this->timeout; }
     inline uint8_t next_execution_major() {
@@ -64,10 +105,12 @@ class Scheduler {
   };
 
   uint32_t millis_();
+  void set_timer_(Component *component, SchedulerItem::Type type, const char *name, bool copy_name, uint32_t delay,
+                  std::function<void()> func);
   void cleanup_();
   void pop_raw_();
   void push_(std::unique_ptr<SchedulerItem> item);
-  bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
+  bool cancel_item_(Component *component, const char *name, SchedulerItem::Type type);
   bool empty_() {
     this->cleanup_();
     return this->items_.empty();
@@ -79,6 +122,109 @@ class Scheduler {
   uint32_t last_millis_{0};
   uint8_t millis_major_{0};
   uint32_t to_remove_{0};
+#else
+  /// Index of an item in the item pool.
+  using item_index_t = uint16_t;
+
+  static const item_index_t WHEEL_NONE = 0xFFFF;
+  /// Number of wheel levels; each level has 2^WHEEL_SLOT_BITS slots and is 2^WHEEL_SLOT_BITS times coarser than the
+  /// previous one. With 4 levels of 64 slots the wheel spans ~4.6 hours, later deadlines go into an overflow list.
+  static const uint8_t WHEEL_LEVELS = 4;
+  static const uint8_t WHEEL_SLOT_BITS = 6;
+  static const uint8_t WHEEL_SLOTS = 1 << WHEEL_SLOT_BITS;
+  /// Items are allocated in chunks of this size, so their addresses stay stable while the pool grows.
+  static const uint8_t WHEEL_POOL_CHUNK = 16;
+
+  // Lists an item can be linked into, in addition to the WHEEL_LEVELS * WHEEL_SLOTS slot lists.
+  static const uint16_t LIST_OVERFLOW = WHEEL_LEVELS * WHEEL_SLOTS;
+  static const uint16_t LIST_PENDING = LIST_OVERFLOW + 1;
+  static const uint16_t LIST_FIRING = LIST_OVERFLOW + 2;
+  static const uint16_t LIST_FREE = LIST_OVERFLOW + 3;
+  static const uint16_t LIST_COUNT = LIST_OVERFLOW + 4;
+  /// Not linked into any list, i.e. currently being executed.
+  static const uint16_t LIST_NONE = 0xFFFF;
+
+  struct SchedulerItem {
+    enum Type : uint8_t { TIMEOUT, INTERVAL };
+
+    std::function<void()> callback;
+    uint64_t deadline;
+    Component *component;
+    /// Either a string with static storage duration or, if name_is_dynamic, a copy owned by this item.
+    const char *name{""};
+    uint32_t name_hash{SCHEDULER_NO_NAME};
+    uint32_t interval;
+    item_index_t prev;
+    item_index_t next;
+    item_index_t index_next;
+    uint16_t list;
+    Type type;
+    bool remove;
+    bool name_is_dynamic{false};
+
+    SchedulerItem() = default;
+    SchedulerItem(const SchedulerItem &) = delete;
+    SchedulerItem &operator=(const SchedulerItem &) = delete;
+    ~SchedulerItem() { this->set_name("", false); }
+
+    bool is_named() const { return this->name_hash != SCHEDULER_NO_NAME; }
+    bool matches(Component *component, const char *name, uint32_t name_hash, Type type) const {
+      return this->component == component && this->name_hash == name_hash && this->type == type &&
+             strcmp(this->name, name) == 0;
+    }
+    /// Take \p name, and ownership of it if \p is_dynamic, releasing the previous name.
+    void set_name(const char *name, bool is_dynamic) {
+      if (this->name_is_dynamic)
+        delete[] this->name;  // NOLINT(cppcoreguidelines-owning-memory)
+      this->name = name;
+      this->name_hash = fnv1_hash(name);
+      this->name_is_dynamic = is_dynamic;
+    }
+  };
+
+  uint64_t millis_();
+  void set_timer_(Component *component, SchedulerItem::Type type, const char *name, bool copy_name, uint32_t delay,
+                  std::function<void()> func);
+  void set_item_(Component *component, const char *name, bool name_is_dynamic, SchedulerItem::Type type,
+                 uint32_t interval, uint64_t deadline, std::function<void()> func);
+  bool cancel_item_(Component *component, const char *name, SchedulerItem::Type type);
+
+  /// The item at \p index, requires lock_ because another task may grow (and reallocate) pool_.
+  SchedulerItem &item_(item_index_t index) {
+    return this->pool_[index / WHEEL_POOL_CHUNK][index % WHEEL_POOL_CHUNK];
+  }
+  item_index_t alloc_item_();
+  void free_item_(item_index_t index);
+  void link_(item_index_t index, uint16_t list);
+  void unlink_(item_index_t index);
+
+  uint32_t index_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type) const;
+  item_index_t index_find_(Component *component, const char *name, uint32_t name_hash, SchedulerItem::Type type);
+  void index_insert_(item_index_t index);
+  void index_remove_(item_index_t index);
+
+  void schedule_(item_index_t index);
+  void cascade_(uint16_t list);
+  void advance_(uint64_t now);
+  uint64_t next_event_tick_() const;
+
+  Mutex lock_;
+  std::vector<std::unique_ptr<SchedulerItem[]>> pool_;
+  /// Open hash index of all named, non-cancelled items keyed by (component, name hash, type), chained by index_next.
+  std::vector<item_index_t> index_;
+  size_t index_count_{0};
+  item_index_t heads_[LIST_COUNT];
+  /// Tails of the pending and firing lists, which are appended to.
+  item_index_t tails_[2];
+  /// One bit per non-empty slot, per level.
+  uint64_t occupied_[WHEEL_LEVELS]{};
+  /// Number of items in the wheel slots and overflow list.
+  uint32_t scheduled_{0};
+  /// First tick (in 64-bit milliseconds) that has not been processed yet.
+  uint64_t current_tick_{0};
+  uint32_t last_millis_{0};
+  uint8_t millis_major_{0};
+#endif  // USE_SCHEDULER_TIMER_WHEEL
 };
 
 }  // namespace esphome
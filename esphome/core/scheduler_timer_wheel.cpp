@@ -0,0 +1,435 @@
+#include "scheduler.h"
+
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+
+#include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/hal.h"
+#include <cinttypes>
+
+namespace esphome {
+
+static const char *const TAG = "scheduler";
+
+// The timer wheel backend stores all items in a chunked pool that is never shrunk, so after warmup no heap
+// allocations happen for set_timeout()/set_interval() (apart from what std::function needs for large captures).
+//
+// Time is kept in 64-bit milliseconds (the 8-bit millis major in the upper half), so no rollover handling is needed
+// when comparing deadlines. Level 0 of the wheel has one slot per millisecond, level n one slot per 64^n ms. An item
+// is placed at the lowest level that can represent its remaining delay and is cascaded down to a finer level when the
+// wheel reaches its slot. Non-empty slots are tracked in a bitmap per level, so advancing over idle periods and
+// computing next_schedule_in() are a handful of bit operations instead of a walk over all ticks.
+//
+// Every item is linked into exactly one intrusive list (a wheel slot, the overflow list, the pending list, the firing
+// list or the free list), except while its callback runs. This makes cancelling O(1): look up the item in the hash
+// index and unlink it from whatever list it is in.
+//
+// Locking follows the heap backend: `lock_` must be held whenever the lists or the index are modified, and whenever
+// pool_ is indexed, since set_timeout() from another task may grow it. Callbacks are executed without holding the
+// lock, through a pointer into their (stable) chunk.
+
+static inline uint64_t rotate_right(uint64_t value, uint8_t amount) {
+  if (amount == 0)
+    return value;
+  return (value >> amount) | (value << (64 - amount));
+}
+
+Scheduler::Scheduler() {
+  for (auto &head : this->heads_)
+    head = WHEEL_NONE;
+  for (auto &tail : this->tails_)
+    tail = WHEEL_NONE;
+}
+
+void HOT Scheduler::set_timer_(Component *component, SchedulerItem::Type type, const char *name, bool copy_name,
+                               uint32_t delay, std::function<void()> func) {
+  const uint64_t now = this->millis_();
+
+  if (name == nullptr || *name == '\0') {
+    name = "";
+    copy_name = false;
+  } else {
+    this->cancel_item_(component, name, type);
+  }
+
+  if (delay == SCHEDULER_DONT_RUN)
+    return;
+
+  uint64_t deadline = now + delay;
+  if (type == SchedulerItem::TIMEOUT) {
+    ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%" PRIu32 ")", name, delay);
+  } else {
+    // only put offset in lower half
+    uint32_t offset = 0;
+    if (delay != 0)
+      offset = (random_uint32() % delay) / 2;
+
+    ESP_LOGVV(TAG, "set_interval(name='%s', interval=%" PRIu32 ", offset=%" PRIu32 ")", name, delay, offset);
+
+    // Same phase as the heap backend: the first execution is due immediately, later ones are shifted by the offset.
+    deadline = now > offset ? now - offset : 0;
+  }
+  this->set_item_(component, copy_name ? copy_name_(name) : name, copy_name, type, delay, deadline, std::move(func));
+}
+void HOT Scheduler::set_item_(Component *component, const char *name, bool name_is_dynamic, SchedulerItem::Type type,
+                              uint32_t interval, uint64_t deadline, std::function<void()> func) {
+  LockGuard guard{this->lock_};
+  item_index_t index = this->alloc_item_();
+  if (index == WHEEL_NONE) {
+    ESP_LOGE(TAG, "Too many scheduler items, dropping '%s'", name);
+    if (name_is_dynamic)
+      delete[] name;  // NOLINT(cppcoreguidelines-owning-memory)
+    return;
+  }
+  auto &item = this->item_(index);
+  item.callback = std::move(func);
+  item.deadline = deadline;
+  item.component = component;
+  item.set_name(name, name_is_dynamic);
+  item.interval = interval;
+  item.type = type;
+  item.remove = false;
+  if (item.is_named())
+    this->index_insert_(index);
+  this->link_(index, LIST_PENDING);
+}
+bool HOT Scheduler::cancel_item_(Component *component, const char *name, SchedulerItem::Type type) {
+  // unnamed items can't be cancelled
+  if (name == nullptr || *name == '\0')
+    return false;
+  const uint32_t name_hash = fnv1_hash(name);
+  // obtain lock because this function modifies the lists and can be called from non-loop task context
+  LockGuard guard{this->lock_};
+  item_index_t index = this->index_find_(component, name, name_hash, type);
+  if (index == WHEEL_NONE)
+    return false;
+
+  this->index_remove_(index);
+  auto &item = this->item_(index);
+  if (item.list == LIST_NONE) {
+    // Currently executing, call() frees it once the callback returns.
+    item.remove = true;
+  } else {
+    this->unlink_(index);
+    this->free_item_(index);
+  }
+  return true;
+}
+
+optional<uint32_t> HOT Scheduler::next_schedule_in() {
+  if (this->scheduled_ == 0)
+    return {};
+  const uint64_t now = this->millis_();
+  const uint64_t next = this->next_event_tick_();
+  if (next <= now)
+    return 0;
+  return (uint32_t) std::min<uint64_t>(next - now, UINT32_MAX);
+}
+void HOT Scheduler::call() {
+  const uint64_t now = this->millis_();
+  this->process_to_add();
+
+  {
+    LockGuard guard{this->lock_};
+    this->advance_(now);
+  }
+
+#ifdef ESPHOME_DEBUG_SCHEDULER
+  static uint64_t last_print = 0;
+
+  if (now - last_print > 2000) {
+    last_print = now;
+    ESP_LOGVV(TAG, "Items: scheduled=%" PRIu32 ", pool=%u, indexed=%u, now=%" PRIu64, this->scheduled_,
+              this->pool_.size() * WHEEL_POOL_CHUNK, this->index_count_, now);
+    for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+      ESP_LOGVV(TAG, "  level %u: occupied=0x%016" PRIx64, level, this->occupied_[level]);
+    }
+  }
+#endif  // ESPHOME_DEBUG_SCHEDULER
+
+  while (true) {
+    item_index_t index;
+    SchedulerItem *item_ptr;
+    {
+      LockGuard guard{this->lock_};
+      index = this->heads_[LIST_FIRING];
+      if (index == WHEEL_NONE)
+        break;
+      this->unlink_(index);
+      // Another task may grow pool_ (and reallocate it) as soon as the lock is released, only the chunks are stable.
+      item_ptr = &this->item_(index);
+    }
+    auto &item = *item_ptr;
+
+    // Don't run on failed components
+    if (item.component != nullptr && item.component->is_failed()) {
+      LockGuard guard{this->lock_};
+      if (item.is_named())
+        this->index_remove_(index);
+      this->free_item_(index);
+      continue;
+    }
+
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+    ESP_LOGVV(TAG, "Running %s '%s' with interval=%" PRIu32 " deadline=%" PRIu64 " (now=%" PRIu64 ")",
+              item.type == SchedulerItem::INTERVAL ? "interval" : "timeout", item.name, item.interval,
+              item.deadline, now);
+#endif
+
+    // Items are allocated in chunks, so `item` stays valid even if the callback adds items to the pool. If the callback
+    // cancels this item, it is only marked for removal.
+    {
+      WarnIfComponentBlockingGuard guard{item.component, item.name_hash};
+      item.callback();
+    }
+
+    LockGuard guard{this->lock_};
+    if (item.remove || item.type == SchedulerItem::TIMEOUT) {
+      if (!item.remove && item.is_named())
+        this->index_remove_(index);
+      this->free_item_(index);
+      continue;
+    }
+
+    if (item.interval != 0) {
+      // skip executions that were missed because the loop was blocked
+      uint64_t missed = now - item.deadline;
+      if (missed < item.interval) {
+        item.deadline += item.interval;
+      } else {
+        item.deadline += (missed / item.interval + 1) * item.interval;
+      }
+    } else {
+      item.deadline = now;
+    }
+    // Re-added at the end of this call, so that zero intervals run once per call.
+    this->link_(index, LIST_PENDING);
+  }
+
+  this->process_to_add();
+}
+void HOT Scheduler::process_to_add() {
+  LockGuard guard{this->lock_};
+  if (this->heads_[LIST_PENDING] == WHEEL_NONE)
+    return;
+
+  if (this->scheduled_ == 0) {
+    // Nothing in the wheel, so it can be fast-forwarded to now without skipping any slot.
+    const uint64_t now = this->millis_();
+    if (this->current_tick_ < now)
+      this->current_tick_ = now;
+  }
+  while (this->heads_[LIST_PENDING] != WHEEL_NONE) {
+    item_index_t index = this->heads_[LIST_PENDING];
+    this->unlink_(index);
+    this->schedule_(index);
+  }
+}
+void HOT Scheduler::schedule_(item_index_t index) {
+  auto &item = this->item_(index);
+  // overdue items go into the slot of the current tick
+  const uint64_t when = std::max(item.deadline, this->current_tick_);
+  const uint64_t delta = when - this->current_tick_;
+  for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+    const uint8_t shift = level * WHEEL_SLOT_BITS;
+    if (delta < (1ULL << (shift + WHEEL_SLOT_BITS))) {
+      const uint16_t slot = (when >> shift) & (WHEEL_SLOTS - 1);
+      this->link_(index, level * WHEEL_SLOTS + slot);
+      return;
+    }
+  }
+  this->link_(index, LIST_OVERFLOW);
+}
+void HOT Scheduler::cascade_(uint16_t list) {
+  while (this->heads_[list] != WHEEL_NONE) {
+    item_index_t index = this->heads_[list];
+    this->unlink_(index);
+    this->schedule_(index);
+  }
+}
+void HOT Scheduler::advance_(uint64_t now) {
+  while (this->scheduled_ != 0) {
+    const uint64_t tick = this->next_event_tick_();
+    if (tick > now)
+      break;
+    this->current_tick_ = tick;
+
+    // Cascade coarse levels first, an item may move down several levels within one tick.
+    const uint8_t overflow_shift = WHEEL_LEVELS * WHEEL_SLOT_BITS;
+    if ((tick & ((1ULL << overflow_shift) - 1)) == 0)
+      this->cascade_(LIST_OVERFLOW);
+    for (uint8_t level = WHEEL_LEVELS - 1; level > 0; level--) {
+      const uint8_t shift = level * WHEEL_SLOT_BITS;
+      if ((tick & ((1ULL << shift) - 1)) != 0)
+        continue;
+      this->cascade_(level * WHEEL_SLOTS + ((tick >> shift) & (WHEEL_SLOTS - 1)));
+    }
+
+    // All items in the level 0 slot of this tick are due, execute them in order.
+    const uint16_t slot = tick & (WHEEL_SLOTS - 1);
+    while (this->heads_[slot] != WHEEL_NONE) {
+      item_index_t index = this->heads_[slot];
+      this->unlink_(index);
+      this->link_(index, LIST_FIRING);
+    }
+    this->current_tick_ = tick + 1;
+  }
+  if (this->current_tick_ <= now)
+    this->current_tick_ = now + 1;
+}
+uint64_t HOT Scheduler::next_event_tick_() const {
+  const uint64_t tick = this->current_tick_;
+  uint64_t next = UINT64_MAX;
+  for (uint8_t level = 0; level < WHEEL_LEVELS; level++) {
+    const uint64_t occupied = this->occupied_[level];
+    if (occupied == 0)
+      continue;
+    // First tick at or after the current one at which this level's slots are visited, and the slot visited then.
+    const uint8_t shift = level * WHEEL_SLOT_BITS;
+    const uint64_t base = ((tick + (1ULL << shift) - 1) >> shift) << shift;
+    const uint8_t start = (base >> shift) & (WHEEL_SLOTS - 1);
+    const uint8_t offset = __builtin_ctzll(rotate_right(occupied, start));
+    next = std::min<uint64_t>(next, base + ((uint64_t) offset << shift));
+  }
+  if (this->heads_[LIST_OVERFLOW] != WHEEL_NONE) {
+    const uint8_t shift = WHEEL_LEVELS * WHEEL_SLOT_BITS;
+    next = std::min<uint64_t>(next, ((tick + (1ULL << shift) - 1) >> shift) << shift);
+  }
+  return next;
+}
+
+Scheduler::item_index_t Scheduler::alloc_item_() {
+  if (this->heads_[LIST_FREE] == WHEEL_NONE) {
+    const size_t first = this->pool_.size() * WHEEL_POOL_CHUNK;
+    if (first + WHEEL_POOL_CHUNK > WHEEL_NONE)
+      return WHEEL_NONE;
+    this->pool_.emplace_back(new SchedulerItem[WHEEL_POOL_CHUNK]);  // NOLINT(cppcoreguidelines-owning-memory)
+    for (size_t i = first; i < first + WHEEL_POOL_CHUNK; i++) {
+      this->item_(i).list = LIST_NONE;
+      this->link_(i, LIST_FREE);
+    }
+  }
+  item_index_t index = this->heads_[LIST_FREE];
+  this->unlink_(index);
+  return index;
+}
+void Scheduler::free_item_(item_index_t index) {
+  auto &item = this->item_(index);
+  // release whatever the callback captured, and the name if it is a copy
+  item.callback = nullptr;
+  item.set_name("", false);
+  this->link_(index, LIST_FREE);
+}
+void HOT Scheduler::link_(item_index_t index, uint16_t list) {
+  auto &item = this->item_(index);
+  item.list = list;
+  item.prev = WHEEL_NONE;
+  if (list == LIST_PENDING || list == LIST_FIRING) {
+    // append, these lists are processed in insertion order
+    auto &tail = this->tails_[list - LIST_PENDING];
+    item.next = WHEEL_NONE;
+    item.prev = tail;
+    if (tail == WHEEL_NONE) {
+      this->heads_[list] = index;
+    } else {
+      this->item_(tail).next = index;
+    }
+    tail = index;
+  } else {
+    item.next = this->heads_[list];
+    if (item.next != WHEEL_NONE)
+      this->item_(item.next).prev = index;
+    this->heads_[list] = index;
+  }
+
+  if (list < LIST_OVERFLOW)
+    this->occupied_[list / WHEEL_SLOTS] |= 1ULL << (list % WHEEL_SLOTS);
+  if (list <= LIST_OVERFLOW)
+    this->scheduled_++;
+}
+void HOT Scheduler::unlink_(item_index_t index) {
+  auto &item = this->item_(index);
+  const uint16_t list = item.list;
+  if (item.prev != WHEEL_NONE) {
+    this->item_(item.prev).next = item.next;
+  } else {
+    this->heads_[list] = item.next;
+  }
+  if (item.next != WHEEL_NONE) {
+    this->item_(item.next).prev = item.prev;
+  } else if (list == LIST_PENDING || list == LIST_FIRING) {
+    this->tails_[list - LIST_PENDING] = item.prev;
+  }
+  item.list = LIST_NONE;
+
+  if (list < LIST_OVERFLOW && this->heads_[list] == WHEEL_NONE)
+    this->occupied_[list / WHEEL_SLOTS] &= ~(1ULL << (list % WHEEL_SLOTS));
+  if (list <= LIST_OVERFLOW)
+    this->scheduled_--;
+}
+
+uint32_t Scheduler::index_bucket_(Component *component, uint32_t name_hash, SchedulerItem::Type type) const {
+  uint32_t hash = name_hash ^ ((uint32_t) reinterpret_cast<uintptr_t>(component) * 2654435761UL) ^ type;
+  return hash & (this->index_.size() - 1);
+}
+Scheduler::item_index_t Scheduler::index_find_(Component *component, const char *name, uint32_t name_hash,
+                                               SchedulerItem::Type type) {
+  if (this->index_.empty())
+    return WHEEL_NONE;
+  item_index_t index = this->index_[this->index_bucket_(component, name_hash, type)];
+  while (index != WHEEL_NONE) {
+    auto &item = this->item_(index);
+    if (item.matches(component, name, name_hash, type))
+      return index;
+    index = item.index_next;
+  }
+  return WHEEL_NONE;
+}
+void Scheduler::index_insert_(item_index_t index) {
+  if (this->index_count_ >= this->index_.size()) {
+    // keep the load factor at or below 1
+    std::vector<item_index_t> old = std::move(this->index_);
+    this->index_.assign(std::max<size_t>(16, old.size() * 2), static_cast<item_index_t>(WHEEL_NONE));
+    for (item_index_t head : old) {
+      while (head != WHEEL_NONE) {
+        item_index_t next = this->item_(head).index_next;
+        auto &item = this->item_(head);
+        auto &bucket = this->index_[this->index_bucket_(item.component, item.name_hash, item.type)];
+        item.index_next = bucket;
+        bucket = head;
+        head = next;
+      }
+    }
+  }
+  auto &item = this->item_(index);
+  auto &bucket = this->index_[this->index_bucket_(item.component, item.name_hash, item.type)];
+  item.index_next = bucket;
+  bucket = index;
+  this->index_count_++;
+}
+void Scheduler::index_remove_(item_index_t index) {
+  auto &item = this->item_(index);
+  item_index_t *link = &this->index_[this->index_bucket_(item.component, item.name_hash, item.type)];
+  while (*link != WHEEL_NONE) {
+    if (*link == index) {
+      *link = item.index_next;
+      this->index_count_--;
+      return;
+    }
+    link = &this->item_(*link).index_next;
+  }
+}
+
+uint64_t Scheduler::millis_() {
+  const uint32_t now = millis();
+  if (now < this->last_millis_) {
+    ESP_LOGD(TAG, "Incrementing scheduler major");
+    this->millis_major_++;
+  }
+  this->last_millis_ = now;
+  return (uint64_t(this->millis_major_) << 32) | now;
+}
+
+}  // namespace esphome
+
+#endif  // USE_SCHEDULER_TIMER_WHEEL
@@ -0,0 +1,41 @@
+// Counting replacements of the global operator new/delete, linked into the targets that measure heap use.
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include "testing.h"
+
+namespace {
+// Each block is prefixed with its size, padded to keep the alignment malloc() guarantees.
+const size_t HEADER_SIZE = alignof(std::max_align_t);
+uint64_t count = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+int64_t bytes = 0;   // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+}  // namespace
+
+void *operator new(size_t size) {
+  auto *block = static_cast<char *>(malloc(size + HEADER_SIZE));
+  if (block == nullptr)
+    abort();
+  *reinterpret_cast<size_t *>(block) = size;
+  count++;
+  bytes += size;
+  return block + HEADER_SIZE;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *ptr) noexcept {
+  if (ptr == nullptr)
+    return;
+  char *block = static_cast<char *>(ptr) - HEADER_SIZE;
+  bytes -= *reinterpret_cast<size_t *>(block);
+  free(block);
+}
+void operator delete[](void *ptr) noexcept { operator delete(ptr); }
+void operator delete(void *ptr, size_t) noexcept { operator delete(ptr); }
+void operator delete[](void *ptr, size_t) noexcept { operator delete(ptr); }
+
+namespace esphome {
+namespace testing {
+uint64_t allocation_count() { return count; }
+int64_t allocated_bytes() { return bytes; }
+}  // namespace testing
+}  // namespace esphome
@@ -0,0 +1,130 @@
+// Throughput of APIPlaintextFrameHelper::write_packets(), the path the API state batches take.
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "esphome/components/api/api_frame_helper.h"
+#include "esphome/components/api/proto.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::api;
+
+/// Socket that accepts everything and copies it into a ring buffer, like the kernel copies into its send buffer.
+class SinkSocket : public socket::Socket {
+ public:
+  std::unique_ptr<Socket> accept(struct sockaddr *addr, socklen_t *addrlen) override { return nullptr; }
+  int bind(const struct sockaddr *addr, socklen_t addrlen) override { return 0; }
+  int close() override { return 0; }
+  int shutdown(int how) override { return 0; }
+  int getpeername(struct sockaddr *addr, socklen_t *addrlen) override { return 0; }
+  std::string getpeername() override { return "bench"; }
+  int getsockname(struct sockaddr *addr, socklen_t *addrlen) override { return 0; }
+  std::string getsockname() override { return "bench"; }
+  int getsockopt(int level, int optname, void *optval, socklen_t *optlen) override { return 0; }
+  int setsockopt(int level, int optname, const void *optval, socklen_t optlen) override { return 0; }
+  int listen(int backlog) override { return 0; }
+  ssize_t read(void *buf, size_t len) override { return 0; }
+  ssize_t readv(const struct iovec *iov, int iovcnt) override { return 0; }
+  ssize_t write(const void *buf, size_t len) override {
+    struct iovec iov = {const_cast<void *>(buf), len};
+    return this->writev(&iov, 1);
+  }
+  ssize_t writev(const struct iovec *iov, int iovcnt) override {
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+      // the sink is larger than any write, so it is only wrapped around between iovecs
+      if (this->pos_ + iov[i].iov_len > sizeof(this->sink_))
+        this->pos_ = 0;
+      uint8_t *dst = this->sink_ + this->pos_;
+      memcpy(dst, iov[i].iov_base, iov[i].iov_len);
+      if (this->capture)
+        this->captured.insert(this->captured.end(), dst, dst + iov[i].iov_len);
+      this->pos_ += iov[i].iov_len;
+      total += iov[i].iov_len;
+    }
+    this->bytes += total;
+    this->writes++;
+    return total;
+  }
+  ssize_t sendto(const void *buf, size_t len, int flags, const struct sockaddr *to, socklen_t tolen) override {
+    return len;
+  }
+  int setblocking(bool blocking) override { return 0; }
+
+  uint64_t bytes{0};
+  uint64_t writes{0};
+  bool capture{false};
+  std::vector<uint8_t> captured;
+
+ protected:
+  uint8_t sink_[16384];
+  size_t pos_{0};
+};
+
+/// Write batches of \p per_batch packets with \p payload byte payloads, like APIConnection::flush_state_batch_().
+static void bench(const char *name, size_t per_batch, size_t payload) {
+  auto socket = std::unique_ptr<SinkSocket>(new SinkSocket());
+  auto *sink = socket.get();
+  APIPlaintextFrameHelper helper(std::move(socket));
+  CHECK(helper.init() == APIError::OK);
+
+  std::vector<uint8_t> data(per_batch * payload);
+  for (size_t i = 0; i < data.size(); i++)
+    data[i] = i;
+  std::vector<PacketInfo> packets;
+  for (size_t i = 0; i < per_batch; i++)
+    packets.push_back(PacketInfo{25, static_cast<uint32_t>(i * payload), static_cast<uint32_t>(payload)});
+
+  const uint32_t batches = 2000000 / per_batch;
+  const uint64_t allocations = testing::allocation_count();
+  const double ns = testing::time_per_call_ns(batches, [&](uint32_t i) {
+    CHECK(helper.write_packets(data.data(), packets.data(), packets.size()) == APIError::OK);
+  });
+  const double seconds = ns * batches / 1e9;
+  printf("%-24s %7.2f M frames/s, %7.1f MB/s on the wire, %.2f allocations per write\n", name,
+         per_batch * batches / seconds / 1e6, sink->bytes / seconds / 1e6,
+         double(testing::allocation_count() - allocations) / batches);
+}
+
+/// Check the framing of a batch that mixes empty, small and large payloads.
+static void verify() {
+  auto socket = std::unique_ptr<SinkSocket>(new SinkSocket());
+  auto *sink = socket.get();
+  sink->capture = true;
+  APIPlaintextFrameHelper helper(std::move(socket));
+  CHECK(helper.init() == APIError::OK);
+
+  const uint32_t lengths[] = {9, 0, 300, 64, 65, 1};
+  std::vector<uint8_t> data, expected;
+  std::vector<PacketInfo> packets;
+  for (uint32_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    const uint16_t type = 200 + i;
+    packets.push_back(PacketInfo{type, static_cast<uint32_t>(data.size()), lengths[i]});
+    expected.push_back(0x00);
+    ProtoVarInt(lengths[i]).encode(expected);
+    ProtoVarInt(type).encode(expected);
+    for (uint32_t j = 0; j < lengths[i]; j++) {
+      data.push_back(i * 31 + j);
+      expected.push_back(i * 31 + j);
+    }
+  }
+  for (size_t count = 1; count <= packets.size(); count++) {
+    sink->captured.clear();
+    CHECK(helper.write_packets(data.data(), packets.data(), count) == APIError::OK);
+    CHECK(sink->captured.size() <= expected.size());
+    CHECK(std::equal(sink->captured.begin(), sink->captured.end(), expected.begin()));
+  }
+  CHECK(sink->captured == expected);
+}
+
+int main() {
+  verify();
+  // sensor states are ~9 bytes, a full batch write is limited to 1436 payload bytes
+  bench("1 x 9 B", 1, 9);
+  bench("16 x 9 B", 16, 9);
+  bench("159 x 9 B (full batch)", 159, 9);
+  bench("8 x 160 B", 8, 160);
+  return 0;
+}
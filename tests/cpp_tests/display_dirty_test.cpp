@@ -0,0 +1,190 @@
+// Dirty rectangle tracking of DisplayBuffer: render frames into a memory-backed display whose flush writes the dirty
+// windows into an emulated panel, like st7789v and st7735 do, and count the bytes sent per frame.
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "esphome/components/display/display_buffer.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::display;
+
+/// Bytes to start a window: CASET and RASET with two 16 bit addresses each, then RAMWR.
+static const size_t WINDOW_OVERHEAD = 3 + 4 + 4;
+
+class MemoryDisplay : public DisplayBuffer {
+ public:
+  MemoryDisplay(int width, int height)
+      : width_(width), height_(height), panel_(size_t(width) * height * 2, 0xAA), full_frame_bytes_(panel_.size()) {
+    this->init_internal_(this->panel_.size());
+    // the panel memory is undefined after reset, the drivers clear it with the first flush
+    this->mark_dirty_all_();
+  }
+  ~MemoryDisplay() { ExternalRAMAllocator<uint8_t>().deallocate(this->buffer_, this->panel_.size()); }
+
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  DisplayType get_display_type() override { return DISPLAY_TYPE_COLOR; }
+
+  /// Write the dirty windows to the panel, returns the bytes that went over the bus.
+  size_t flush() {
+    size_t bytes = 0;
+    if (this->dirty_count_ == 0)
+      return bytes;
+    this->coalesce_dirty_();
+    for (uint8_t i = 0; i < this->dirty_count_; i++) {
+      const Rect &rect = this->dirty_rects_[i];
+      CHECK(rect.x >= 0 && rect.y >= 0 && rect.x2() <= this->width_ && rect.y2() <= this->height_);
+      for (int row = rect.y; row < rect.y2(); row++) {
+        const size_t offset = (size_t(row) * this->width_ + rect.x) * 2;
+        memcpy(this->panel_.data() + offset, this->buffer_ + offset, rect.w * 2);
+      }
+      bytes += WINDOW_OVERHEAD + size_t(rect.w) * rect.h * 2;
+    }
+    this->windows += this->dirty_count_;
+    this->clear_dirty_();
+    return bytes;
+  }
+
+  /// The panel shows exactly what was drawn into the buffer.
+  bool in_sync() const { return memcmp(this->panel_.data(), this->buffer_, this->panel_.size()) == 0; }
+
+  size_t full_frame_bytes() const { return WINDOW_OVERHEAD + this->full_frame_bytes_; }
+  uint32_t windows{0};
+
+ protected:
+  void draw_absolute_pixel_internal(int x, int y, Color color) override {
+    if (x >= this->width_ || x < 0 || y >= this->height_ || y < 0)
+      return;
+    const uint16_t color565 = ColorUtil::color_to_565(color);
+    uint8_t *pos = this->buffer_ + (x + y * this->width_) * 2;
+    if (pos[0] == (color565 >> 8) && pos[1] == (color565 & 0xff))
+      return;
+    pos[0] = color565 >> 8;
+    pos[1] = color565 & 0xff;
+    this->mark_dirty_(x, y);
+  }
+  void fill_span_internal_(int x, int y, int width, Color color) override {
+    this->fill_span_rgb565_(x, y, width, ColorUtil::color_to_565(color));
+  }
+  void blit_rgb565_span_internal_(int x, int y, const uint8_t *data, int width, bool transparent) override {
+    this->blit_rgb565_span_rgb565_(x, y, data, width, transparent);
+  }
+
+  int width_;
+  int height_;
+  std::vector<uint8_t> panel_;
+  size_t full_frame_bytes_;
+};
+
+/// A seven segment digit of 24x40 pixels, like a clock face drawn with rectangles.
+static void draw_digit(Display &display, int x, int y, int digit, Color color) {
+  static const uint8_t SEGMENTS[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
+  const uint8_t on = SEGMENTS[digit];
+  if (on & 0x01)
+    display.filled_rectangle(x + 4, y, 16, 4, color);  // top
+  if (on & 0x02)
+    display.filled_rectangle(x + 20, y + 4, 4, 14, color);  // top right
+  if (on & 0x04)
+    display.filled_rectangle(x + 20, y + 22, 4, 14, color);  // bottom right
+  if (on & 0x08)
+    display.filled_rectangle(x + 4, y + 36, 16, 4, color);  // bottom
+  if (on & 0x10)
+    display.filled_rectangle(x, y + 22, 4, 14, color);  // bottom left
+  if (on & 0x20)
+    display.filled_rectangle(x, y + 4, 4, 14, color);  // top left
+  if (on & 0x40)
+    display.filled_rectangle(x + 4, y + 18, 16, 4, color);  // middle
+}
+
+/// A clock with seconds, a progress bar and a blinking status dot, redrawn from scratch like do_update_() does with
+/// auto_clear_enabled. clear() and the redraw both change every lit pixel, so all of them are dirty in every frame.
+static void draw_clock(Display &display, int second) {
+  const Color white(255, 255, 255);
+  display.clear();
+  draw_digit(display, 40, 60, (second / 600) % 6, white);
+  draw_digit(display, 70, 60, (second / 60) % 10, white);
+  draw_digit(display, 120, 60, (second / 10) % 6, white);
+  draw_digit(display, 150, 60, second % 10, white);
+  display.filled_rectangle(20, 200, 280, 10, Color(0, 0, 80));
+  display.filled_rectangle(20, 200, (second % 60) * 280 / 59, 10, Color(0, 200, 0));
+  display.filled_circle(300, 20, 5, second % 2 ? Color(255, 0, 0) : COLOR_OFF);
+}
+
+int main() {
+  MemoryDisplay display(320, 240);
+  const size_t full = display.full_frame_bytes();
+
+  // The first flush sends everything
+  CHECK(display.flush() == full);
+  CHECK(display.in_sync());
+  CHECK(display.flush() == 0);
+
+  // Drawing pixels with the color they already have sends nothing
+  draw_clock(display, 0);
+  display.flush();
+  CHECK(display.in_sync());
+  display.filled_rectangle(20, 200, 280, 10, Color(0, 0, 80));
+  display.filled_circle(300, 20, 5, COLOR_OFF);
+  display.draw_pixel_at(0, 0, COLOR_OFF);
+  CHECK(display.flush() == 0);
+
+  // A clock ticking for ten minutes
+  size_t clock_bytes = 0;
+  const int seconds = 600;
+  display.windows = 0;
+  for (int second = 1; second <= seconds; second++) {
+    draw_clock(display, second);
+    const size_t bytes = display.flush();
+    CHECK(bytes > 0 && bytes < full / 4);
+    CHECK(display.in_sync());
+    clock_bytes += bytes;
+  }
+  printf("clock:      %6zu bytes per frame, full frame %zu bytes (%.1f%%), %.2f windows per frame\n",
+         clock_bytes / seconds, full, 100.0 * clock_bytes / seconds / full, double(display.windows) / seconds);
+  CHECK(clock_bytes / seconds < full / 8);
+
+  // Without auto clear, a lambda that only redraws the seconds digit sends just that digit
+  size_t digit_bytes = 0;
+  for (int second = 0; second < 10; second++) {
+    display.filled_rectangle(150, 60, 24, 40, COLOR_OFF);
+    draw_digit(display, 150, 60, second, Color(255, 255, 255));
+    const size_t bytes = display.flush();
+    CHECK(bytes <= WINDOW_OVERHEAD + 24 * 40 * 2);
+    CHECK(display.in_sync());
+    digit_bytes += bytes;
+  }
+  printf("digit:      %6zu bytes per frame\n", digit_bytes / 10);
+
+  // Scattered single pixels, also through the rotated paths, end up in few windows and always reach the panel
+  srand(3);
+  const DisplayRotation rotations[] = {DISPLAY_ROTATION_0_DEGREES, DISPLAY_ROTATION_90_DEGREES,
+                                       DISPLAY_ROTATION_180_DEGREES, DISPLAY_ROTATION_270_DEGREES};
+  size_t scattered_bytes = 0;
+  for (int frame = 0; frame < 200; frame++) {
+    display.set_rotation(rotations[frame % 4]);
+    const int pixels = frame < 100 ? 1 + rand() % 8 : 5000;
+    for (int i = 0; i < pixels; i++)
+      display.draw_pixel_at(rand() % display.get_width(), rand() % display.get_height(), Color(rand(), rand(), rand()));
+    display.horizontal_line(rand() % 320 - 40, rand() % 240, rand() % 200, Color(rand(), 0, 0));
+    display.line(rand() % 320, rand() % 240, rand() % 320, rand() % 240, Color(0, rand(), 0));
+    const uint32_t windows = display.windows;
+    const size_t bytes = display.flush();
+    CHECK(display.in_sync());
+    CHECK(bytes <= full);
+    CHECK(display.windows - windows <= 4);
+    scattered_bytes += bytes;
+  }
+  printf("scattered:  %6zu bytes per frame\n", scattered_bytes / 200);
+
+  // Filling the screen is one full window
+  display.set_rotation(DISPLAY_ROTATION_0_DEGREES);
+  display.fill(Color(1, 2, 3));
+  CHECK(display.flush() == full);
+  CHECK(display.in_sync());
+
+  printf("display_dirty_test: OK\n");
+  return 0;
+}
@@ -0,0 +1,30 @@
+// Deterministic host implementation of esphome/core/hal.h for the tests: time only moves when a test says so.
+
+#include "esphome/core/hal.h"
+#include "esphome/core/preferences.h"
+#include "testing.h"
+
+namespace esphome {
+
+static uint32_t fake_millis = 0;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+namespace testing {
+void set_millis(uint32_t now) { fake_millis = now; }
+void advance_millis(uint32_t ms) { fake_millis += ms; }
+}  // namespace testing
+
+void yield() {}
+uint32_t millis() { return fake_millis; }
+uint32_t micros() { return fake_millis * 1000U; }
+void delay(uint32_t ms) { fake_millis += ms; }
+void delayMicroseconds(uint32_t us) {}
+void arch_restart() { abort(); }
+void arch_init() {}
+void arch_feed_wdt() {}
+uint32_t arch_get_cpu_cycle_count() { return micros(); }
+uint32_t arch_get_cpu_freq_hz() { return 1000000; }
+uint8_t progmem_read_byte(const uint8_t *addr) { return *addr; }
+
+ESPPreferences *global_preferences = nullptr;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+}  // namespace esphome
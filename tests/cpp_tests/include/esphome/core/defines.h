@@ -0,0 +1,8 @@
+#pragma once
+
+// Replaces the IDE version of this file for the host tests, so that only the feature flags a test passes with -D are
+// enabled, like in a generated build.
+
+#include "esphome/core/macros.h"
+
+#define ESPHOME_BOARD "host"
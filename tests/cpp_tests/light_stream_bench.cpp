@@ -0,0 +1,297 @@
+// Streaming LED data into a 1200 LED strip: AddressableLight::write_rgb()/write_rgbw() against setting every LED
+// through operator[], and the WLED and Adalight effects replaying UDP packets and serial frames of a 60 fps stream.
+// The LEDs end up the same either way.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "esphome/components/adalight/adalight_light_effect.h"
+#include "esphome/components/light/addressable_light.h"
+#include "esphome/core/helpers.h"
+#include "testing.h"
+
+// The WLED effect is only built with Arduino, whose WiFiUDP is replaced by one replaying packets. Its source is
+// compiled into this benchmark, the rest of the tree is built without USE_ARDUINO.
+class UDP {
+ public:
+  virtual ~UDP() = default;
+  virtual uint8_t begin(uint16_t port) = 0;
+  virtual void stop() = 0;
+  virtual int parsePacket() = 0;                               // NOLINT(readability-identifier-naming)
+  virtual int read(unsigned char *buffer, size_t length) = 0;  // NOLINT
+};
+
+static std::deque<std::vector<uint8_t>> udp_packets;  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
+
+class WiFiUDP : public UDP {
+ public:
+  uint8_t begin(uint16_t port) override { return 1; }
+  void stop() override {}
+  int parsePacket() override {
+    if (!this->packet_.empty())
+      udp_packets.pop_front();
+    this->packet_.clear();
+    if (udp_packets.empty())
+      return 0;
+    this->packet_ = udp_packets.front();
+    return this->packet_.size();
+  }
+  int read(unsigned char *buffer, size_t length) override {
+    length = std::min(length, this->packet_.size());
+    memcpy(buffer, this->packet_.data(), length);
+    return length;
+  }
+
+ protected:
+  std::vector<uint8_t> packet_;
+};
+
+#define USE_ARDUINO
+#include "esphome/components/wled/wled_light_effect.cpp"
+#undef USE_ARDUINO
+
+using namespace esphome;
+using namespace esphome::light;
+
+static const int32_t LED_COUNT = 1200;
+
+/// An RGBW strip in memory, laid out like the neopixelbus and fastled buffers.
+class MemoryLight : public AddressableLight {
+ public:
+  explicit MemoryLight(int32_t size) : leds_(size * 4), effect_data_(size) {}
+
+  int32_t size() const override { return this->effect_data_.size(); }
+  void clear_effect_data() override { std::fill(this->effect_data_.begin(), this->effect_data_.end(), 0); }
+  LightTraits get_traits() override {
+    LightTraits traits;
+    traits.set_supported_color_modes({ColorMode::RGB_WHITE});
+    return traits;
+  }
+  void write_state(LightState *state) override {}
+  /// Set by update_state() from the light's brightness while an effect runs.
+  void set_local_brightness(uint8_t brightness) { this->correction_.set_local_brightness(brightness); }
+
+  bool operator==(const MemoryLight &rhs) const { return this->leds_ == rhs.leds_; }
+  bool operator!=(const MemoryLight &rhs) const { return !(*this == rhs); }
+
+ protected:
+  ESPColorView get_view_internal(int32_t index) const override {
+    uint8_t *led = const_cast<uint8_t *>(&this->leds_[index * 4]);
+    return {led, led + 1, led + 2, led + 3, const_cast<uint8_t *>(&this->effect_data_[index]), &this->correction_};
+  }
+
+  std::vector<uint8_t> leds_;
+  std::vector<uint8_t> effect_data_;
+};
+
+/// A UART whose receive buffer the benchmark fills.
+class MemoryUART : public uart::UARTComponent {
+ public:
+  void write_array(const uint8_t *data, size_t len) override {}
+  bool peek_byte(uint8_t *data) override {
+    if (this->rx_.empty())
+      return false;
+    *data = this->rx_.front();
+    return true;
+  }
+  bool read_array(uint8_t *data, size_t len) override {
+    if (len > this->rx_.size())
+      return false;
+    std::copy(this->rx_.begin(), this->rx_.begin() + len, data);
+    this->rx_.erase(this->rx_.begin(), this->rx_.begin() + len);
+    return true;
+  }
+  int available() override { return this->rx_.size(); }
+  void flush() override {}
+
+  void receive(const std::vector<uint8_t> &data) { this->rx_.insert(this->rx_.end(), data.begin(), data.end()); }
+
+ protected:
+  void check_logger_conflict() override {}
+
+  std::deque<uint8_t> rx_;
+};
+
+class WLEDEffect : public wled::WLEDLightEffect {
+ public:
+  WLEDEffect() : WLEDLightEffect("WLED") { this->set_port(21324); }
+};
+
+class AdalightEffect : public adalight::AdalightLightEffect {
+ public:
+  explicit AdalightEffect(uart::UARTComponent *uart) : AdalightLightEffect("Adalight") { this->set_uart_parent(uart); }
+};
+
+/// How the LEDs were set from streamed data before the bulk writes.
+static void set_each_led(AddressableLight &it, int32_t offset, const uint8_t *data, int32_t count, int channels,
+                         bool white_from_rgb) {
+  for (int32_t led = offset; led < offset + count && led < it.size(); led++, data += channels) {
+    uint8_t white = 0;
+    if (channels == 4) {
+      white = data[3];
+    } else if (white_from_rgb) {
+      white = std::min(std::min(data[0], data[1]), data[2]);
+    }
+    it[led].set(Color(data[0], data[1], data[2], white));
+  }
+}
+
+static std::vector<uint8_t> random_pixels(int32_t count, int channels) {
+  std::vector<uint8_t> pixels(count * channels);
+  for (auto &value : pixels)
+    value = rand();
+  return pixels;
+}
+
+/// A DNRGB packet of WLED's realtime UDP protocol, up to 489 LEDs starting at \p offset.
+static std::vector<uint8_t> dnrgb_packet(const uint8_t *pixels, uint16_t offset, uint16_t count) {
+  std::vector<uint8_t> packet = {4, 2, uint8_t(offset >> 8), uint8_t(offset)};
+  packet.insert(packet.end(), pixels + offset * 3, pixels + (offset + count) * 3);
+  return packet;
+}
+
+/// An Adalight frame as sent by Prismatik and Hyperion.
+static std::vector<uint8_t> adalight_frame(const std::vector<uint8_t> &pixels) {
+  const uint16_t count = pixels.size() / 3 - 1;
+  std::vector<uint8_t> frame = {'A', 'd', 'a', uint8_t(count >> 8), uint8_t(count),
+                               uint8_t((count >> 8) ^ count ^ 0x55)};
+  frame.insert(frame.end(), pixels.begin(), pixels.end());
+  return frame;
+}
+
+int main() {
+  srand(9);
+  testing::set_millis(1000);
+  MemoryLight light(LED_COUNT);
+  MemoryLight expected(LED_COUNT);
+  AddressableLightState state(&light);
+  AddressableLightState expected_state(&expected);
+  light.setup_state(&state);
+  expected.setup_state(&expected_state);
+  const uint32_t frames = 2000;
+  printf("%d LEDs\n", LED_COUNT);
+
+  // Bulk writes give the same LEDs as setting them one by one, through every correction the table caches
+  const std::vector<uint8_t> rgb = random_pixels(LED_COUNT, 3);
+  const std::vector<uint8_t> rgbw = random_pixels(LED_COUNT, 4);
+  for (float max_brightness : {1.0f, 0.5f, 0.8f}) {
+    for (uint8_t local_brightness : {255, 96}) {
+      for (auto *it : {&light, &expected}) {
+        it->set_correction(max_brightness, max_brightness * 0.9f, max_brightness, 0.7f);
+        it->set_local_brightness(local_brightness);
+      }
+      light.write_rgb(0, rgb.data(), LED_COUNT, true);
+      set_each_led(expected, 0, rgb.data(), LED_COUNT, 3, true);
+      CHECK(light == expected);
+      light.write_rgbw(100, rgbw.data(), LED_COUNT);
+      set_each_led(expected, 100, rgbw.data(), LED_COUNT, 4, false);
+      CHECK(light == expected);
+    }
+  }
+  light.write_rgb(-1, rgb.data(), LED_COUNT);
+  light.write_rgb(LED_COUNT, rgb.data(), LED_COUNT);
+  CHECK(light == expected);
+
+  double ns =
+      testing::time_per_call_ns(frames, [&](uint32_t i) { set_each_led(light, 0, rgb.data(), LED_COUNT, 3, false); });
+  printf("%-32s %8.1f us per frame\n", "RGB operator[].set()", ns / 1000);
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) { light.write_rgb(0, rgb.data(), LED_COUNT); });
+  printf("%-32s %8.1f us per frame\n", "write_rgb()", ns / 1000);
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) { set_each_led(light, 0, rgbw.data(), LED_COUNT, 4, false); });
+  printf("%-32s %8.1f us per frame\n", "RGBW operator[].set()", ns / 1000);
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) { light.write_rgbw(0, rgbw.data(), LED_COUNT); });
+  printf("%-32s %8.1f us per frame\n", "write_rgbw()", ns / 1000);
+  set_each_led(expected, 0, rgbw.data(), LED_COUNT, 4, false);
+  CHECK(light == expected);
+
+  // WLED: a frame is three DNRGB packets, a DRGBW packet and an invalid packet are dropped in between
+  std::vector<std::vector<uint8_t>> wled_frames;
+  for (int i = 0; i < 8; i++)
+    wled_frames.push_back(random_pixels(LED_COUNT, 3));
+  WLEDEffect wled;
+  wled.init_internal(&state);
+  wled.start();
+  auto send_wled_frame = [&](const std::vector<uint8_t> &pixels) {
+    for (uint16_t offset = 0; offset < LED_COUNT; offset += 489)
+      udp_packets.push_back(dnrgb_packet(pixels.data(), offset, std::min<int32_t>(489, LED_COUNT - offset)));
+  };
+  std::vector<uint8_t> drgbw = {3, 2};
+  drgbw.insert(drgbw.end(), rgbw.begin(), rgbw.begin() + 360 * 4);
+  udp_packets.push_back(drgbw);
+  udp_packets.push_back({2, 2, 1, 2});
+  wled.apply(light, Color::BLACK);
+  set_each_led(expected, 0, rgbw.data(), 360, 4, false);
+  CHECK(udp_packets.empty());
+  CHECK(light == expected);
+  for (const auto &pixels : wled_frames) {
+    send_wled_frame(pixels);
+    wled.apply(light, Color::BLACK);
+    set_each_led(expected, 0, pixels.data(), LED_COUNT, 3, false);
+    CHECK(light == expected);
+  }
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) {
+    const auto &pixels = wled_frames[i % wled_frames.size()];
+    send_wled_frame(pixels);
+    for (; !udp_packets.empty(); udp_packets.pop_front()) {
+      const auto &packet = udp_packets.front();
+      const uint16_t offset = (packet[2] << 8) | packet[3];
+      set_each_led(light, offset, packet.data() + 4, (packet.size() - 4) / 3, 3, false);
+    }
+  });
+  printf("%-32s %8.1f us per frame\n", "WLED DNRGB operator[].set()", ns / 1000);
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) {
+    send_wled_frame(wled_frames[i % wled_frames.size()]);
+    wled.apply(light, Color::BLACK);
+  });
+  printf("%-32s %8.1f us per frame\n", "WLED DNRGB effect", ns / 1000);
+  wled.stop();
+
+  // Adalight: frames arrive in chunks of the UART buffer, a corrupt and an over-long frame are dropped on the way
+  MemoryUART uart;
+  AdalightEffect adalight(&uart);
+  adalight.init_internal(&state);
+  adalight.start();
+  adalight.apply(light, Color::BLACK);
+  std::vector<std::vector<uint8_t>> adalight_frames;
+  for (const auto &pixels : wled_frames)
+    adalight_frames.push_back(adalight_frame(pixels));
+  std::vector<uint8_t> stream = {'A', 'd', 'x'};
+  auto corrupt = adalight_frames[0];
+  corrupt[5] ^= 1;
+  stream.insert(stream.end(), corrupt.begin(), corrupt.begin() + 6);
+  stream.insert(stream.end(), adalight_frames[1].begin(), adalight_frames[1].end());
+  const std::vector<uint8_t> longer = adalight_frame(random_pixels(LED_COUNT + 10, 3));
+  stream.insert(stream.end(), longer.begin(), longer.end());
+  stream.insert(stream.end(), adalight_frames[2].begin(), adalight_frames[2].end());
+  for (size_t offset = 0; offset < stream.size(); offset += 256) {
+    uart.receive(std::vector<uint8_t>(stream.begin() + offset, stream.begin() + std::min(offset + 256, stream.size())));
+    adalight.apply(light, Color::BLACK);
+  }
+  CHECK(uart.available() == 0);
+  set_each_led(expected, 0, wled_frames[2].data(), LED_COUNT, 3, true);
+  CHECK(light == expected);
+
+  std::vector<uint8_t> frame;
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) {
+    uart.receive(adalight_frames[i % adalight_frames.size()]);
+    // before: byte by byte into a growing frame, then every LED through operator[]
+    frame.clear();
+    uint8_t data;
+    while (uart.available() != 0 && uart.read_byte(&data))
+      frame.push_back(data);
+    set_each_led(light, 0, frame.data() + 6, LED_COUNT, 3, true);
+  });
+  printf("%-32s %8.1f us per frame\n", "Adalight read_byte() + set()", ns / 1000);
+  ns = testing::time_per_call_ns(frames, [&](uint32_t i) {
+    uart.receive(adalight_frames[i % adalight_frames.size()]);
+    adalight.apply(light, Color::BLACK);
+  });
+  printf("%-32s %8.1f us per frame\n", "Adalight effect", ns / 1000);
+  set_each_led(expected, 0, wled_frames[(frames - 1) % wled_frames.size()].data(), LED_COUNT, 3, true);
+  CHECK(light == expected);
+  adalight.stop();
+  return 0;
+}
@@ -0,0 +1,219 @@
+// MQTT subscription matching and unsubscribing, replaying the messages an ESPHome node received from a broker it
+// shares with Home Assistant, zigbee2mqtt and Tasmota devices. Compared with matching every subscription one by one
+// (before the trie) and with rebuilding the trie on unsubscribe.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "esphome/components/mqtt/mqtt_topic_trie.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::mqtt;
+
+/// The matcher the client used for every subscription before the trie.
+static bool topic_match(const char *message, const char *subscription, bool is_normal, bool past_separator) {
+  if (*message == '\0' && *subscription == '\0')
+    return true;
+  if (*message == '\0' || *subscription == '\0')
+    return false;
+  bool do_wildcards = is_normal || past_separator;
+  if (*subscription == '+' && do_wildcards) {
+    subscription++;
+    while (*message != '\0' && *message != '/')
+      message++;
+    return topic_match(message, subscription, is_normal, true);
+  }
+  if (*subscription == '#' && do_wildcards)
+    return true;
+  if (*message != *subscription)
+    return false;
+  past_separator = past_separator || *subscription == '/';
+  return topic_match(message + 1, subscription + 1, is_normal, past_separator);
+}
+
+static bool topic_match(const std::string &message, const std::string &subscription) {
+  return topic_match(message.c_str(), subscription.c_str(), !message.empty() && message[0] != '$', false);
+}
+
+/// Subscriptions of a node with 40 entities and a few on_message triggers, in subscription order.
+static std::vector<std::string> node_subscriptions() {
+  std::vector<std::string> filters;
+  for (int i = 0; i < 12; i++)
+    filters.push_back("livingroom/switch/relay_" + std::to_string(i) + "/command");
+  for (int i = 0; i < 6; i++) {
+    const std::string light = "livingroom/light/strip_" + std::to_string(i);
+    filters.push_back(light + "/command");
+  }
+  for (int i = 0; i < 4; i++) {
+    const std::string climate = "livingroom/climate/zone_" + std::to_string(i);
+    for (const char *command : {"mode", "target_temperature", "target_temperature_low", "target_temperature_high",
+                                "fan_mode", "swing_mode", "preset"})
+      filters.push_back(climate + "/" + command + "/command");
+  }
+  for (int i = 0; i < 6; i++)
+    filters.push_back("livingroom/number/setpoint_" + std::to_string(i) + "/command");
+  filters.push_back("livingroom/cover/blinds/command");
+  filters.push_back("livingroom/cover/blinds/position/command");
+  filters.push_back("homeassistant/status");
+  filters.push_back("esphome/discover/#");
+  filters.push_back("zigbee2mqtt/+/action");
+  filters.push_back("zigbee2mqtt/bridge/state");
+  filters.push_back("tele/+/SENSOR");
+  filters.push_back("stat/+/POWER");
+  filters.push_back("livingroom/#");
+  return filters;
+}
+
+/// A capture of the topics the node received, in arrival order.
+static const char *const RECORDED_TOPICS[] = {
+    "homeassistant/status",
+    "livingroom/status",
+    "livingroom/debug",
+    "zigbee2mqtt/bridge/state",
+    "zigbee2mqtt/hallway_button/action",
+    "livingroom/switch/relay_3/command",
+    "livingroom/switch/relay_3/state",
+    "tele/plug_kitchen/SENSOR",
+    "tele/plug_office/SENSOR",
+    "stat/plug_kitchen/POWER",
+    "livingroom/light/strip_2/command",
+    "livingroom/light/strip_2/state",
+    "zigbee2mqtt/bedroom_remote/action",
+    "livingroom/climate/zone_1/target_temperature/command",
+    "livingroom/climate/zone_1/target_temperature/state",
+    "livingroom/climate/zone_1/mode/command",
+    "livingroom/climate/zone_1/mode/state",
+    "tele/plug_kitchen/SENSOR",
+    "esphome/discover/livingroom",
+    "esphome/discover/garage",
+    "livingroom/number/setpoint_4/command",
+    "livingroom/number/setpoint_4/state",
+    "livingroom/cover/blinds/position/command",
+    "livingroom/cover/blinds/position/state",
+    "livingroom/sensor/temperature/state",
+    "livingroom/sensor/humidity/state",
+    "zigbee2mqtt/hallway_button/action",
+    "stat/plug_office/POWER",
+    "livingroom/switch/relay_11/command",
+    "livingroom/switch/relay_11/state",
+    "tele/plug_office/SENSOR",
+    "livingroom/climate/zone_3/fan_mode/command",
+    "livingroom/climate/zone_3/fan_mode/state",
+    "homeassistant/status",
+    "$SYS/broker/uptime",
+};
+static const size_t RECORDED_COUNT = sizeof(RECORDED_TOPICS) / sizeof(RECORDED_TOPICS[0]);
+
+static std::vector<uint16_t> match_linear(const std::vector<std::string> &filters, const std::string &topic) {
+  std::vector<uint16_t> matches;
+  for (size_t i = 0; i < filters.size(); i++) {
+    if (topic_match(topic, filters[i]))
+      matches.push_back(i);
+  }
+  return matches;
+}
+
+static std::vector<uint16_t> match_trie(const MQTTTopicTrie &trie, const std::string &topic) {
+  std::vector<uint16_t> matches;
+  trie.match(topic, matches);
+  std::sort(matches.begin(), matches.end());
+  return matches;
+}
+
+/// The trie and the subscriptions it indexes agree after every removal, like MQTTClientComponent::unsubscribe().
+static void verify(const std::vector<std::string> &topics) {
+  std::vector<std::string> filters = node_subscriptions();
+  // a duplicate and a filter with a partial level wildcard, which is matched without the trie
+  filters.push_back("livingroom/switch/relay_3/command");
+  filters.push_back("tele/plug_+/SENSOR");
+  MQTTTopicTrie trie;
+  for (size_t i = 0; i < filters.size(); i++)
+    trie.insert(filters[i], i);
+
+  srand(7);
+  while (!filters.empty()) {
+    for (const auto &topic : topics)
+      CHECK(match_trie(trie, topic) == match_linear(filters, topic));
+    const std::string filter = filters[rand() % filters.size()];
+    for (size_t i = filters.size(); i-- > 0;) {
+      if (filters[i] != filter)
+        continue;
+      CHECK(trie.remove(filter, i));
+      filters.erase(filters.begin() + i);
+    }
+    CHECK(!trie.remove(filter, 0));
+  }
+  for (const auto &topic : topics)
+    CHECK(match_trie(trie, topic).empty());
+
+  // pruned nodes are reused
+  filters = node_subscriptions();
+  for (size_t i = 0; i < filters.size(); i++)
+    trie.insert(filters[i], i);
+  for (const auto &topic : topics)
+    CHECK(match_trie(trie, topic) == match_linear(filters, topic));
+}
+
+int main() {
+  std::vector<std::string> topics(RECORDED_TOPICS, RECORDED_TOPICS + RECORDED_COUNT);
+  verify(topics);
+
+  const std::vector<std::string> filters = node_subscriptions();
+  MQTTTopicTrie trie;
+  for (size_t i = 0; i < filters.size(); i++)
+    trie.insert(filters[i], i);
+  printf("%zu subscriptions, %zu recorded topics\n", filters.size(), topics.size());
+
+  const uint32_t messages = 500000;
+  uint32_t sink = 0;
+  double ns = testing::time_per_call_ns(messages, [&](uint32_t i) {
+    const std::string &topic = topics[i % RECORDED_COUNT];
+    for (size_t j = 0; j < filters.size(); j++) {
+      if (topic_match(topic, filters[j]))
+        sink += j;
+    }
+  });
+  printf("%-34s %8.1f ns per message\n", "match every subscription", ns);
+
+  std::vector<uint16_t> matches;
+  ns = testing::time_per_call_ns(messages, [&](uint32_t i) {
+    matches.clear();
+    trie.match(topics[i % RECORDED_COUNT], matches);
+    std::sort(matches.begin(), matches.end());
+    sink += matches.size();
+  });
+  printf("%-34s %8.1f ns per message\n", "trie", ns);
+
+  // Unsubscribing and subscribing again, as components do when their command topic changes. The subscription moves
+  // to the end of the list, the ids of the ones after it move down.
+  const uint32_t rounds = 20000;
+  std::vector<std::string> current = filters;
+  uint64_t allocations = testing::allocation_count();
+  ns = testing::time_per_call_ns(rounds, [&](uint32_t i) {
+    const size_t id = i % current.size();
+    std::rotate(current.begin() + id, current.begin() + id + 1, current.end());
+    trie.clear();
+    for (size_t j = 0; j < current.size(); j++)
+      trie.insert(current[j], j);
+  });
+  printf("%-34s %8.1f ns, %5.1f allocations per unsubscribe\n", "rebuild the trie", ns,
+         double(testing::allocation_count() - allocations) / rounds);
+
+  allocations = testing::allocation_count();
+  ns = testing::time_per_call_ns(rounds, [&](uint32_t i) {
+    const size_t id = i % current.size();
+    CHECK(trie.remove(current[id], id));
+    std::rotate(current.begin() + id, current.begin() + id + 1, current.end());
+    trie.insert(current.back(), current.size() - 1);
+  });
+  printf("%-34s %8.1f ns, %5.1f allocations per unsubscribe\n", "remove and prune", ns,
+         double(testing::allocation_count() - allocations) / rounds);
+  for (const auto &topic : topics)
+    CHECK(match_trie(trie, topic) == match_linear(current, topic));
+
+  if (sink == 1)
+    printf(" ");
+  return 0;
+}
@@ -0,0 +1,135 @@
+// PreferenceCache and PreferenceWriteBudget, the latter against the fake millis() of hal.cpp.
+
+#include <map>
+#include <vector>
+
+#include "esphome/core/preference_cache.h"
+#include "testing.h"
+
+using namespace esphome;
+
+static std::vector<uint8_t> bytes(uint32_t v, size_t len) {
+  std::vector<uint8_t> r(len);
+  for (size_t i = 0; i < len; i++)
+    r[i] = uint8_t(v >> (8 * (i % 4))) ^ uint8_t(i);
+  return r;
+}
+
+static void test_basic() {
+  PreferenceCache c;
+  CHECK(c.empty() && c.get_pending(1) == nullptr && c.get_pending_entries().empty());
+  auto v = bytes(42, 7);
+  c.save(1, v.data(), v.size());
+  CHECK(c.pending_count() == 1 && *c.get_pending(1) == v && c.get_pending(2) == nullptr);
+  // replacing a queued value does not add an entry
+  auto w = bytes(43, 3);
+  c.save(1, w.data(), w.size());
+  CHECK(c.pending_count() == 1 && *c.get_pending(1) == w);
+  auto entries = c.get_pending_entries();
+  CHECK(entries.size() == 1 && entries[0]->type == 1);
+  CHECK(!c.is_unchanged(*entries[0]));
+  c.mark_synced(*entries[0]);
+  CHECK(c.empty() && c.get_pending(1) == nullptr && entries[0]->data.capacity() == 0);
+  c.mark_synced(*entries[0]);  // second call is a no-op
+  CHECK(c.pending_count() == 0);
+  // the same value again is recognized as unchanged, a different one is not
+  c.save(1, w.data(), w.size());
+  CHECK(c.is_unchanged(*c.get_pending_entries()[0]));
+  c.save(1, v.data(), v.size());
+  CHECK(!c.is_unchanged(*c.get_pending_entries()[0]));
+  c.clear();
+  CHECK(c.empty() && c.get_pending(1) == nullptr);
+  c.save(1, w.data(), w.size());
+  CHECK(!c.is_unchanged(*c.get_pending_entries()[0]));  // stored CRCs are forgotten by clear()
+}
+
+static void test_set_stored() {
+  PreferenceCache c;
+  auto v = bytes(7, 12);
+  c.set_stored(5, v.data(), v.size());
+  CHECK(c.empty() && c.get_pending(5) == nullptr);
+  c.save(5, v.data(), v.size());
+  CHECK(c.is_unchanged(*c.get_pending_entries()[0]));
+  // zero length values
+  PreferenceCache e;
+  e.save(6, nullptr, 0);
+  CHECK(e.get_pending(6)->empty() && !e.is_unchanged(*e.get_pending_entries()[0]));
+  e.mark_synced(*e.get_pending_entries()[0]);
+  e.save(6, nullptr, 0);
+  CHECK(e.is_unchanged(*e.get_pending_entries()[0]));
+}
+
+// random operations against a std::map model, enough types to grow the table several times
+static void test_random() {
+  srand(1234);
+  PreferenceCache c;
+  std::map<uint32_t, std::vector<uint8_t>> pending, stored;
+  for (int i = 0; i < 200000; i++) {
+    // sequential and hash-like types, so both collide in the probe sequence
+    uint32_t type = (rand() % 2) ? uint32_t(rand() % 300) : uint32_t(rand() % 300) * 0x9E3779B9u;
+    switch (rand() % 6) {
+      case 0:
+      case 1:
+      case 2: {
+        auto v = bytes(rand() % 4, rand() % 20);
+        c.save(type, v.data(), v.size());
+        pending[type] = v;
+        break;
+      }
+      case 3: {
+        auto v = bytes(rand() % 4, rand() % 20);
+        c.set_stored(type, v.data(), v.size());
+        stored[type] = v;
+        break;
+      }
+      case 4: {
+        // sync like the backends do
+        for (auto *entry : c.get_pending_entries()) {
+          auto it = stored.find(entry->type);
+          CHECK(c.is_unchanged(*entry) == (it != stored.end() && it->second == entry->data));
+          stored[entry->type] = entry->data;
+          c.mark_synced(*entry);
+        }
+        pending.clear();
+        break;
+      }
+      case 5:
+        if (rand() % 1000 == 0) {
+          c.clear();
+          pending.clear();
+          stored.clear();
+        }
+        break;
+    }
+    CHECK(c.pending_count() == pending.size());
+    auto *p = c.get_pending(type);
+    auto it = pending.find(type);
+    CHECK((p == nullptr) == (it == pending.end()));
+    if (p != nullptr)
+      CHECK(*p == it->second);
+  }
+}
+
+static void test_budget() {
+  PreferenceWriteBudget b;
+  for (int i = 0; i < 1000; i++)
+    CHECK(b.consume());  // unlimited by default
+  b.set(3, 1000);
+  testing::set_millis(5000);
+  CHECK(b.consume(2) && !b.consume(2) && b.consume() && !b.consume());
+  testing::set_millis(5999);
+  CHECK(!b.consume());
+  testing::set_millis(6000);  // new window
+  CHECK(b.consume(3) && !b.consume());
+  testing::set_millis(6000 + 0xFFFFFFFFu);  // millis() rollover
+  CHECK(b.consume(3) && !b.consume());
+}
+
+int main() {
+  test_basic();
+  test_set_stored();
+  test_random();
+  test_budget();
+  printf("preference_cache_test: OK\n");
+  return 0;
+}
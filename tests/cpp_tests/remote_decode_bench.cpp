@@ -0,0 +1,162 @@
+// Dispatch of received IR frames to the listeners and dumpers of a receiver, replaying timing captures of four remotes
+// to a node with `dump: all` and binary sensors for 40 buttons. Compared with every listener and dumper decoding the
+// frame itself (before decode_cached()), and checked across two receivers that share protocols.
+
+#include <vector>
+
+#include "esphome/components/remote_base/aeha_protocol.h"
+#include "esphome/components/remote_base/canalsat_protocol.h"
+#include "esphome/components/remote_base/coolix_protocol.h"
+#include "esphome/components/remote_base/dish_protocol.h"
+#include "esphome/components/remote_base/drayton_protocol.h"
+#include "esphome/components/remote_base/jvc_protocol.h"
+#include "esphome/components/remote_base/lg_protocol.h"
+#include "esphome/components/remote_base/magiquest_protocol.h"
+#include "esphome/components/remote_base/nec_protocol.h"
+#include "esphome/components/remote_base/nexa_protocol.h"
+#include "esphome/components/remote_base/panasonic_protocol.h"
+#include "esphome/components/remote_base/pioneer_protocol.h"
+#include "esphome/components/remote_base/rc5_protocol.h"
+#include "esphome/components/remote_base/rc6_protocol.h"
+#include "esphome/components/remote_base/samsung36_protocol.h"
+#include "esphome/components/remote_base/samsung_protocol.h"
+#include "esphome/components/remote_base/sony_protocol.h"
+#include "esphome/components/remote_base/toshiba_ac_protocol.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::remote_base;
+
+// Captured with a TSOP38238, which stretches marks and shortens spaces by 40 to 90 us. The gap after the last mark
+// ends the frame and isn't part of it.
+// NEC address 0x7F80 command 0xEE11
+static const int32_t NEC_CAPTURE[] = {
+    9063,  -4416, 647,   -475, 603,   -475, 631,   -489, 639,   -497, 600,   -504, 618,   -486, 611,   -501,
+    631,   -1616, 613,   -1632, 623,  -1646, 617,  -1629, 605,  -1615, 612,  -1602, 601,  -1627, 626,  -1624,
+    619,   -497,  622,   -1625, 618,  -515, 606,   -510, 628,   -513, 626,   -1602, 641,  -481, 618,   -495,
+    623,   -487,  645,   -473, 637,   -1638, 618,  -1606, 649,  -1618, 642,  -520, 607,   -1632, 627,  -1623,
+    643,   -1649, 604};
+// Samsung 0xE0E040BF, 32 bits
+static const int32_t SAMSUNG_CAPTURE[] = {
+    4554, -4452, 610, -1626, 636, -1633, 602, -1615, 611, -477,  605, -484,  616, -482,  631, -505,  627, -475,
+    635,  -1627, 644, -1630, 615, -1606, 629, -485,  623, -514,  628, -494,  612, -478,  634, -497,  618, -497,
+    642,  -1628, 608, -517,  615, -505,  641, -486,  605, -496,  649, -488,  619, -483,  605, -1635, 609, -498,
+    610,  -1612, 607, -1615, 647, -1613, 612, -1641, 630, -1602, 632, -1650, 621};
+// Sony 0xA90, 12 bits
+static const int32_t SONY_CAPTURE[] = {2463, -529, 1270, -522, 686, -536, 1262, -559, 688, -536, 1275, -540, 653,
+                                       -518, 675,  -538, 1254, -513, 650, -537, 673,  -553, 651, -513, 659};
+// LG 0x20DF10EF, 32 bits
+static const int32_t LG_CAPTURE[] = {
+    8085, -3959, 683, -493,  668, -494,  640, -1549, 645, -463,  675, -481,  640, -475,  645, -474,  645, -492,
+    668,  -1517, 682, -1515, 680, -505,  658, -1535, 654, -1531, 662, -1527, 662, -1540, 677, -1544, 679, -493,
+    672,  -471,  668, -471,  676, -1545, 661, -471,  643, -484,  665, -500,  687, -505,  643, -1519, 640, -1516,
+    686,  -1541, 659, -497,  688, -1516, 688, -1537, 654, -1525, 679, -1557, 643};
+
+template<size_t N> static RawTimings capture(const int32_t (&timings)[N]) { return RawTimings(timings, timings + N); }
+
+/// A receiver whose frames come from captures instead of a pin.
+class ReplayReceiver : public RemoteReceiverBase {
+ public:
+  ReplayReceiver() : RemoteReceiverBase(nullptr) { this->set_tolerance(25); }
+
+  void replay(const RawTimings &frame) {
+    this->temp_ = frame;
+    this->call_listeners_dumpers_();
+  }
+  /// Dispatch like the receivers did before decode_cached(), every listener and dumper decodes the frame itself.
+  void replay_uncached(const RawTimings &frame) {
+    this->temp_ = frame;
+    for (auto *listener : this->listeners_)
+      listener->on_receive(RemoteReceiveData(this->temp_, this->tolerance_));
+    for (auto *dumper : this->dumpers_)
+      dumper->dump(RemoteReceiveData(this->temp_, this->tolerance_));
+  }
+};
+
+/// The dumpers of `dump: all`, without Pronto and raw whose formatting dominates the cost.
+static void register_dumpers(ReplayReceiver &receiver) {
+  RemoteReceiverDumperBase *dumpers[] = {
+      new AEHADumper(),      new CanalSatDumper(),  new CanalSatLDDumper(), new CoolixDumper(), new DishDumper(),
+      new DraytonDumper(),   new JVCDumper(),       new LGDumper(),         new MagiQuestDumper(), new NECDumper(),
+      new NexaDumper(),      new PanasonicDumper(), new PioneerDumper(),    new RC5Dumper(),       new RC6Dumper(),
+      new Samsung36Dumper(), new SamsungDumper(),   new SonyDumper(),       new ToshibaAcDumper(),
+  };
+  for (auto *dumper : dumpers)
+    receiver.register_dumper(dumper);
+}
+
+/// A button of a remote, counting its presses.
+template<typename S, typename D> static S *button(ReplayReceiver &receiver, D data, uint32_t &presses) {
+  auto *sensor = new S();
+  sensor->set_data(data);
+  sensor->add_on_state_callback([&presses](bool state) {
+    if (state)
+      presses++;
+  });
+  receiver.register_listener(sensor);
+  return sensor;
+}
+
+int main() {
+  const RawTimings nec = capture(NEC_CAPTURE);
+  const RawTimings samsung = capture(SAMSUNG_CAPTURE);
+  const RawTimings sony = capture(SONY_CAPTURE);
+  const RawTimings lg = capture(LG_CAPTURE);
+
+  // Two receivers with buttons of the same protocol: each one's frames only press its own buttons
+  uint32_t presses_a = 0;
+  uint32_t presses_b = 0;
+  uint32_t presses_wrong = 0;
+  ReplayReceiver receiver_a;
+  ReplayReceiver receiver_b;
+  button<NECBinarySensor>(receiver_a, NECData{0x7F80, 0xEE11}, presses_a);
+  button<NECBinarySensor>(receiver_a, NECData{0x7F80, 0xEF10}, presses_wrong);
+  button<NECBinarySensor>(receiver_b, NECData{0x7F80, 0xEE11}, presses_b);
+  button<SamsungBinarySensor>(receiver_b, SamsungData{0xE0E040BF, 32}, presses_b);
+  button<SonyBinarySensor>(receiver_b, SonyData{0xA90, 12}, presses_wrong);
+  receiver_a.replay(nec);
+  CHECK(presses_a == 1 && presses_b == 0);
+  receiver_b.replay(samsung);
+  CHECK(presses_a == 1 && presses_b == 1);
+  receiver_a.replay(sony);
+  receiver_b.replay(nec);
+  CHECK(presses_a == 1 && presses_b == 2);
+  receiver_b.replay(lg);
+  receiver_a.replay(nec);
+  receiver_a.replay(nec);
+  CHECK(presses_a == 3 && presses_b == 2);
+  CHECK(presses_wrong == 0);
+  // Decoding outside of a receiver isn't cached
+  CHECK(decode_cached<NECProtocol>(RemoteReceiveData(nec, 25)).has_value());
+  CHECK(!decode_cached<NECProtocol>(RemoteReceiveData(samsung, 25)).has_value());
+
+  // A living room node: 30 buttons of the NEC TV remote, 10 of the Samsung soundbar and everything dumped
+  ReplayReceiver receiver;
+  register_dumpers(receiver);
+  uint32_t presses = 0;
+  for (uint16_t command = 0x11; command < 0x11 + 30; command++)
+    button<NECBinarySensor>(receiver, NECData{0x7F80, uint16_t(((0xFF - command) << 8) | command)}, presses);
+  for (uint32_t i = 0; i < 10; i++)
+    button<SamsungBinarySensor>(receiver, SamsungData{0xE0E040BF + 0x10000 * i, 32}, presses);
+
+  const RawTimings *frames[] = {&nec, &samsung, &nec, &sony, &lg, &nec};
+  const uint32_t count = 6 * 3000;
+  presses = 0;
+  double ns = testing::time_per_call_ns(count, [&](uint32_t i) { receiver.replay_uncached(*frames[i % 6]); });
+  const uint32_t presses_uncached = presses;
+  printf("%-28s %8.1f ns per frame\n", "decode per listener", ns);
+
+  presses = 0;
+  ns = testing::time_per_call_ns(count, [&](uint32_t i) { receiver.replay(*frames[i % 6]); });
+  printf("%-28s %8.1f ns per frame\n", "decode_cached()", ns);
+  // NEC is every other frame and presses one button, Samsung one in six
+  CHECK(presses == presses_uncached);
+  CHECK(presses == count / 2 + count / 6);
+
+  const uint64_t allocations = testing::allocation_count();
+  for (uint32_t i = 0; i < count; i++)
+    receiver.replay(*frames[i % 6]);
+  printf("%-28s %8.2f allocations per frame\n", "decode_cached()",
+         double(testing::allocation_count() - allocations) / count);
+  return 0;
+}
@@ -0,0 +1,67 @@
+// Compares the scheduler backends; built once with the heap (default) and once with USE_SCHEDULER_TIMER_WHEEL.
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/core/scheduler.h"
+#include "testing.h"
+
+using namespace esphome;
+
+static const uint32_t COMPONENTS = 100;
+
+int main() {
+#ifdef USE_SCHEDULER_TIMER_WHEEL
+  const char *backend = "timer_wheel";
+#else
+  const char *backend = "heap";
+#endif
+  std::vector<Component> components(COMPONENTS);
+  std::vector<std::string> names;
+  for (uint32_t i = 0; i < COMPONENTS; i++)
+    names.push_back("remote_transmitter_" + std::to_string(i));
+  uint32_t fired = 0;
+
+  // Heap use of pending named timeouts, with a string literal name like filters and automations use, and with a
+  // (non-SSO) std::string name.
+  Scheduler scheduler;
+  int64_t before = testing::allocated_bytes();
+  for (uint32_t i = 0; i < COMPONENTS; i++)
+    scheduler.set_timeout(&components[i], "debounce", 1000, [&fired]() { fired++; });
+  scheduler.process_to_add();
+  const double bytes_per_literal = double(testing::allocated_bytes() - before) / COMPONENTS;
+  before = testing::allocated_bytes();
+  for (uint32_t i = 0; i < COMPONENTS; i++)
+    scheduler.set_timeout(&components[i], names[i], 1000, [&fired]() { fired++; });
+  scheduler.process_to_add();
+  const double bytes_per_string = double(testing::allocated_bytes() - before) / COMPONENTS;
+
+  // Sensor filters that restart their timeout on every sample while 500 intervals are pending. Each component gets
+  // one sample per loop iteration, and the loop runs once per millisecond.
+  for (uint32_t i = 0; i < 500; i++)
+    scheduler.set_interval(&components[i % COMPONENTS], "interval_" + std::to_string(i), 1000 + i * 7,
+                           [&fired]() { fired++; });
+  const uint32_t samples = 200000;
+  const uint64_t allocations = testing::allocation_count();
+  const double restart_ns = testing::time_per_call_ns(samples, [&](uint32_t i) {
+    scheduler.set_timeout(&components[i % COMPONENTS], "debounce", 50, [&fired]() { fired++; });
+    if (i % COMPONENTS == COMPONENTS - 1) {
+      testing::advance_millis(1);
+      scheduler.call();
+    }
+  });
+  const double restart_allocations = double(testing::allocation_count() - allocations) / samples;
+
+  // The main loop calling the scheduler once per millisecond, with only the intervals left.
+  const double call_ns = testing::time_per_call_ns(200000, [&](uint32_t i) {
+    testing::advance_millis(1);
+    scheduler.call();
+  });
+
+  printf("%-12s heap per named item: %6.1f B (literal), %6.1f B (std::string)\n", backend, bytes_per_literal,
+         bytes_per_string);
+  printf("%-12s filter sample: %6.1f ns (%.2f allocations), idle call(): %6.1f ns (%u callbacks)\n", backend,
+         restart_ns, restart_allocations, call_ns, fired);
+  return 0;
+}
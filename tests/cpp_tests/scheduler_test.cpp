@@ -0,0 +1,86 @@
+// Name handling of the scheduler; built once with the heap (default) and once with USE_SCHEDULER_TIMER_WHEEL.
+
+#include <string>
+
+#include "esphome/core/component.h"
+#include "esphome/core/scheduler.h"
+#include "testing.h"
+
+using namespace esphome;
+
+// Two names with the same FNV-1 hash (0x76f4bf39).
+static const char *const COLLIDING_A = "timer_66358";
+static const char *const COLLIDING_B = "timer_749130";
+
+static void run(Scheduler &scheduler, uint32_t ms) {
+  for (uint32_t i = 0; i < ms; i++) {
+    testing::advance_millis(1);
+    scheduler.call();
+  }
+}
+
+int main() {
+  CHECK(fnv1_hash(COLLIDING_A) == fnv1_hash(COLLIDING_B));
+
+  Component component, other;
+  uint32_t a = 0, b = 0;
+
+  // Names with the same hash are still distinct items, in both directions.
+  {
+    Scheduler scheduler;
+    scheduler.set_timeout(&component, COLLIDING_A, 10, [&a]() { a++; });
+    scheduler.set_timeout(&component, COLLIDING_B, 10, [&b]() { b++; });
+    CHECK(!scheduler.cancel_timeout(&component, "timer_0"));
+    CHECK(scheduler.cancel_timeout(&component, COLLIDING_A));
+    run(scheduler, 20);
+    CHECK(a == 0 && b == 1);
+
+    scheduler.set_interval(&component, std::string(COLLIDING_B), 5, [&b]() { b++; });
+    scheduler.set_interval(&component, std::string(COLLIDING_A), 5, [&a]() { a++; });
+    CHECK(scheduler.cancel_interval(&component, COLLIDING_B));
+    run(scheduler, 20);
+    CHECK(a >= 4 && b == 1);
+    CHECK(scheduler.cancel_interval(&component, COLLIDING_A));
+  }
+
+  // Literal and std::string names of the same text refer to the same item, and replace each other.
+  {
+    Scheduler scheduler;
+    a = b = 0;
+    std::string name = "debounce";
+    scheduler.set_timeout(&component, "debounce", 10, [&a]() { a++; });
+    scheduler.set_timeout(&component, name, 10, [&b]() { b++; });
+    name.assign("something else entirely, longer than the SSO buffer");
+    run(scheduler, 20);
+    CHECK(a == 0 && b == 1);
+
+    scheduler.set_timeout(&component, std::string("debounce"), 10, [&a]() { a++; });
+    CHECK(scheduler.cancel_timeout(&component, "debounce"));
+  }
+
+  // Items are per component and per type, and unnamed items are never replaced or cancelled.
+  {
+    Scheduler scheduler;
+    a = b = 0;
+    scheduler.set_timeout(&component, "x", 10, [&a]() { a++; });
+    scheduler.set_timeout(&other, "x", 10, [&b]() { b++; });
+    scheduler.set_interval(&component, "x", 100, [&b]() { b++; });
+    scheduler.set_timeout(&component, "", 10, [&a]() { a++; });
+    scheduler.set_timeout(&component, nullptr, 10, [&a]() { a++; });
+    scheduler.set_timeout(&component, std::string(), 10, [&a]() { a++; });
+    CHECK(!scheduler.cancel_timeout(&component, ""));
+    CHECK(scheduler.cancel_interval(&component, "x"));
+    run(scheduler, 20);
+    CHECK(a == 4 && b == 1);
+  }
+
+  // Pending std::string names are released with the scheduler (checked by the leak sanitizer).
+  {
+    Scheduler scheduler;
+    for (int i = 0; i < 100; i++)
+      scheduler.set_timeout(&component, "pending_timeout_" + std::to_string(i), 1000, []() {});
+  }
+
+  printf("scheduler_test: OK\n");
+  return 0;
+}
@@ -0,0 +1,55 @@
+// Time per value of the sliding window sensor filters, previous implementation against the incremental one.
+
+#include <cstdlib>
+#include <vector>
+
+#include "esphome/components/sensor/filter.h"
+#include "sensor_filter_reference.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::sensor;
+using testing::ReferenceWindowFilter;
+
+template<typename F> static double time_filter(F &filter, const std::vector<float> &values) {
+  float sink = 0;
+  const double ns = testing::time_per_call_ns(values.size(), [&](uint32_t i) {
+    auto result = filter.new_value(values[i]);
+    if (result.has_value())
+      sink += *result;
+  });
+  // keep the results alive
+  if (sink == 1234.5f)
+    printf(" ");
+  return ns;
+}
+
+int main() {
+  srand(1);
+  std::vector<float> values(200000);
+  for (auto &v : values)
+    v = float(rand() % 10000) / 100.0f;
+
+  printf("%-8s %-10s %12s %12s\n", "window", "filter", "before", "after");
+  for (size_t window : {16, 128, 512}) {
+    // send_every 1 is the worst case of the old implementation, as every value sorts the window
+    ReferenceWindowFilter old_median(ReferenceWindowFilter::MEDIAN, window, 1, 1);
+    MedianFilter median(window, 1, 1);
+    printf("%-8zu %-10s %9.1f ns %9.1f ns\n", window, "median", time_filter(old_median, values),
+           time_filter(median, values));
+
+    ReferenceWindowFilter old_quantile(ReferenceWindowFilter::QUANTILE, window, 1, 1, 0.9f);
+    QuantileFilter quantile(window, 1, 1, 0.9f);
+    printf("%-8zu %-10s %9.1f ns %9.1f ns\n", window, "quantile", time_filter(old_quantile, values),
+           time_filter(quantile, values));
+
+    ReferenceWindowFilter old_min(ReferenceWindowFilter::MIN, window, 1, 1);
+    MinFilter min(window, 1, 1);
+    printf("%-8zu %-10s %9.1f ns %9.1f ns\n", window, "min", time_filter(old_min, values), time_filter(min, values));
+
+    ReferenceWindowFilter old_max(ReferenceWindowFilter::MAX, window, 1, 1);
+    MaxFilter max(window, 1, 1);
+    printf("%-8zu %-10s %9.1f ns %9.1f ns\n", window, "max", time_filter(old_max, values), time_filter(max, values));
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+// The sliding window sensor filters as they were before they were updated incrementally, which copy (and sort) the
+// whole window for every value they send. The tests compare against them, the benchmarks time them.
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+#include "esphome/core/optional.h"
+
+namespace esphome {
+namespace testing {
+
+class ReferenceWindowFilter {
+ public:
+  enum Kind { MEDIAN, QUANTILE, MIN, MAX };
+
+  ReferenceWindowFilter(Kind kind, size_t window_size, size_t send_every, size_t send_first_at, float quantile = 0.9f)
+      : kind_(kind),
+        send_every_(send_every),
+        send_at_(send_every - send_first_at),
+        window_size_(window_size),
+        quantile_(quantile) {}
+
+  void set_window_size(size_t window_size) { this->window_size_ = window_size; }
+
+  optional<float> new_value(float value) {
+    while (this->queue_.size() >= this->window_size_)
+      this->queue_.pop_front();
+    this->queue_.push_back(value);
+    if (++this->send_at_ < this->send_every_)
+      return {};
+    this->send_at_ = 0;
+
+    if (this->kind_ == MIN || this->kind_ == MAX) {
+      float result = NAN;
+      for (auto v : this->queue_) {
+        if (!std::isnan(v))
+          result = std::isnan(result) ? v : (this->kind_ == MIN ? std::min(result, v) : std::max(result, v));
+      }
+      return result;
+    }
+
+    std::vector<float> sorted;
+    for (auto v : this->queue_) {
+      if (!std::isnan(v))
+        sorted.push_back(v);
+    }
+    std::sort(sorted.begin(), sorted.end());
+    const size_t size = sorted.size();
+    if (size == 0)
+      return NAN;
+    if (this->kind_ == QUANTILE)
+      return sorted[size_t(ceilf(size * this->quantile_)) - 1];
+    if (size % 2)
+      return sorted[size / 2];
+    return (sorted[size / 2] + sorted[size / 2 - 1]) / 2.0f;
+  }
+
+ protected:
+  Kind kind_;
+  size_t send_every_;
+  size_t send_at_;
+  size_t window_size_;
+  float quantile_;
+  std::deque<float> queue_;
+};
+
+}  // namespace testing
+}  // namespace esphome
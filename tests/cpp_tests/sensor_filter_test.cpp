@@ -0,0 +1,73 @@
+// The incremental median, quantile, min and max sensor filters against the previous implementations.
+
+#include <cstdlib>
+
+#include "esphome/components/sensor/filter.h"
+#include "sensor_filter_reference.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::sensor;
+using testing::ReferenceWindowFilter;
+
+static bool same(const optional<float> &a, const optional<float> &b) {
+  if (a.has_value() != b.has_value())
+    return false;
+  if (!a.has_value())
+    return true;
+  return (std::isnan(*a) && std::isnan(*b)) || *a == *b;
+}
+
+/// Feed the same random values (with NaNs, repeats and a window resize) to both implementations.
+template<typename F>
+static void compare(F &filter, ReferenceWindowFilter::Kind kind, size_t window_size, size_t send_every,
+                    size_t send_first_at, float quantile = 0.9f) {
+  ReferenceWindowFilter reference(kind, window_size, send_every, send_first_at, quantile);
+  for (int i = 0; i < 5000; i++) {
+    if (i == 2500) {
+      // shrink (or grow) the window half way through
+      const size_t resized = window_size / 2 + 1 + (window_size % 3);
+      filter.set_window_size(resized);
+      reference.set_window_size(resized);
+    }
+    float value;
+    const int r = rand() % 20;
+    if (r == 0) {
+      value = NAN;
+    } else if (r < 5) {
+      // repeated values exercise equal keys in the sorted window and the min/max deque
+      value = float(rand() % 4);
+    } else {
+      value = float(rand() % 2001 - 1000) / 10.0f;
+    }
+    if (i >= 1000 && i < 1000 + 3 * window_size)
+      value = NAN;  // a window of only NaNs
+    CHECK(same(filter.new_value(value), reference.new_value(value)));
+  }
+}
+
+int main() {
+  srand(42);
+  const size_t windows[] = {1, 2, 3, 5, 16, 64};
+  for (size_t window : windows) {
+    for (size_t send_every : {size_t(1), size_t(3), window}) {
+      for (size_t send_first_at : {size_t(1), send_every}) {
+        MedianFilter median(window, send_every, send_first_at);
+        compare(median, ReferenceWindowFilter::MEDIAN, window, send_every, send_first_at);
+        QuantileFilter quantile(window, send_every, send_first_at, 0.25f);
+        compare(quantile, ReferenceWindowFilter::QUANTILE, window, send_every, send_first_at, 0.25f);
+        MinFilter min(window, send_every, send_first_at);
+        compare(min, ReferenceWindowFilter::MIN, window, send_every, send_first_at);
+        MaxFilter max(window, send_every, send_first_at);
+        compare(max, ReferenceWindowFilter::MAX, window, send_every, send_first_at);
+      }
+    }
+  }
+  for (float q : {0.01f, 0.5f, 0.9f, 1.0f}) {
+    QuantileFilter quantile(7, 1, 1, q);
+    compare(quantile, ReferenceWindowFilter::QUANTILE, 7, 1, 1, q);
+  }
+
+  printf("sensor_filter_test: OK\n");
+  return 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+// Minimal helpers shared by the host tests and benchmarks, see README.md.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+/// Abort the test with the failing expression and its location if \p cond is false.
+#define CHECK(cond) \
+  do { \
+    if (!(cond)) { \
+      fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+      abort(); \
+    } \
+  } while (0)
+
+namespace esphome {
+namespace testing {
+
+/// Set the value that millis() returns, micros() returns the same time in microseconds.
+void set_millis(uint32_t now);
+/// Advance millis() and micros() by \p ms.
+void advance_millis(uint32_t ms);
+
+/// Number of calls to operator new since the program started, see alloc_count.cpp.
+uint64_t allocation_count();
+/// Bytes currently allocated through operator new, see alloc_count.cpp.
+int64_t allocated_bytes();
+
+/// Average nanoseconds per iteration of \p iterations calls of \p func.
+template<typename F> double time_per_call_ns(uint32_t iterations, F &&func) {
+  const auto start = std::chrono::steady_clock::now();
+  for (uint32_t i = 0; i < iterations; i++)
+    func(i);
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+}  // namespace testing
+}  // namespace esphome
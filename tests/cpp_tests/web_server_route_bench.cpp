@@ -0,0 +1,155 @@
+// Entity lookup for web_server request URLs with 500 entities: the search of the entity lists it replaced,
+// the hashed index that built the object id of every candidate, and RouteIndex.
+
+#include <algorithm>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "esphome/components/web_server/route_index.h"
+#include "esphome/core/helpers.h"
+#include "testing.h"
+
+using namespace esphome;
+using namespace esphome::web_server;
+
+static const char *const DOMAINS[] = {"sensor", "binary_sensor", "switch", "light", "text_sensor",
+                                      "number", "select", "button", "cover", "climate"};
+static const size_t DOMAIN_COUNT = sizeof(DOMAINS) / sizeof(DOMAINS[0]);
+
+struct Entity {
+  const char *domain;
+  EntityBase entity;
+};
+
+/// The web server before the route index: find the entity list of the domain, then compare every object id.
+static EntityBase *find_linear(const std::vector<std::vector<EntityBase *>> &lists, const StringRef &domain,
+                               const StringRef &id) {
+  for (size_t i = 0; i < DOMAIN_COUNT; i++) {
+    if (domain != DOMAINS[i])
+      continue;
+    for (auto *entity : lists[i]) {
+      if (entity->get_object_id() == id)
+        return entity;
+    }
+  }
+  return nullptr;
+}
+
+static uint32_t fnv1_hash(const StringRef &str) {
+  uint32_t hash = 2166136261UL;
+  for (char c : str) {
+    hash *= 16777619UL;
+    hash ^= c;
+  }
+  return hash;
+}
+
+/// Hashed index whose hash hits built the candidate's object id with get_object_id().
+class CopyingIndex {
+ public:
+  void add(const char *domain, EntityBase *entity) {
+    this->routes_.push_back(Route{entity->get_object_id_hash(), domain, entity});
+  }
+  void finish() {
+    std::sort(this->routes_.begin(), this->routes_.end(),
+              [](const Route &a, const Route &b) { return a.object_id_hash < b.object_id_hash; });
+  }
+  EntityBase *find(const StringRef &domain, const StringRef &id) const {
+    const uint32_t hash = fnv1_hash(id);
+    auto it = std::lower_bound(this->routes_.begin(), this->routes_.end(), hash,
+                               [](const Route &route, uint32_t value) { return route.object_id_hash < value; });
+    for (; it != this->routes_.end() && it->object_id_hash == hash; ++it) {
+      if (domain == it->domain && id == it->entity->get_object_id())
+        return it->entity;
+    }
+    return nullptr;
+  }
+
+ protected:
+  struct Route {
+    uint32_t object_id_hash;
+    const char *domain;
+    EntityBase *entity;
+  };
+  std::vector<Route> routes_;
+};
+
+struct Request {
+  StringRef domain;
+  StringRef id;
+  EntityBase *expected;
+};
+
+template<typename F> static void bench(const char *name, const std::vector<Request> &requests, F &&find) {
+  const uint64_t allocations = testing::allocation_count();
+  const double ns = testing::time_per_call_ns(requests.size(), [&](uint32_t i) {
+    const Request &request = requests[i];
+    CHECK(find(request.domain, request.id) == request.expected);
+  });
+  printf("%-22s %8.1f ns per request, %.2f allocations per request\n", name, ns,
+         double(testing::allocation_count() - allocations) / requests.size());
+}
+
+int main() {
+  // 50 entities per domain with object ids like the ones generated from names, longer than the SSO buffer
+  const size_t count = 500;
+  std::vector<std::string> object_ids;
+  object_ids.reserve(count + 2);
+  std::vector<Entity> entities(count + 2);
+  for (size_t i = 0; i < count; i++) {
+    object_ids.push_back("living_room_" + std::string(DOMAINS[i % DOMAIN_COUNT]) + "_" + std::to_string(i));
+    entities[i].domain = DOMAINS[i % DOMAIN_COUNT];
+  }
+  // two ids with the same FNV-1 hash
+  object_ids.push_back("timer_66358");
+  object_ids.push_back("timer_749130");
+  entities[count].domain = entities[count + 1].domain = "switch";
+
+  RouteIndex index;
+  CopyingIndex copying;
+  std::vector<std::vector<EntityBase *>> lists(DOMAIN_COUNT);
+  for (size_t i = 0; i < entities.size(); i++) {
+    entities[i].entity.set_name(object_ids[i].c_str());
+    entities[i].entity.set_object_id(object_ids[i].c_str());
+    lists[std::find(DOMAINS, DOMAINS + DOMAIN_COUNT, StringRef(entities[i].domain)) - DOMAINS].push_back(
+        &entities[i].entity);
+    index.add(entities[i].domain, &entities[i].entity);
+    copying.add(entities[i].domain, &entities[i].entity);
+  }
+  index.finish();
+  copying.finish();
+  CHECK(index.size() == entities.size());
+
+  // Every entity is found under its own domain only, colliding ids included
+  for (auto &e : entities) {
+    const std::string id = e.entity.get_object_id();
+    CHECK(index.find(StringRef(e.domain), StringRef(id)) == &e.entity);
+    CHECK(index.find(StringRef("fan"), StringRef(id)) == nullptr);
+  }
+  CHECK(index.find(StringRef("switch"), StringRef("timer_0")) == nullptr);
+
+  // Requests for random entities, one in ten for an id that does not exist
+  srand(5);
+  std::vector<std::string> unknown_ids;
+  for (int i = 0; i < 16; i++)
+    unknown_ids.push_back("unknown_entity_" + std::to_string(i));
+  std::vector<Request> requests;
+  for (int i = 0; i < 200000; i++) {
+    if (rand() % 10 == 0) {
+      const char *domain = DOMAINS[rand() % DOMAIN_COUNT];
+      requests.push_back(Request{StringRef(domain), StringRef(unknown_ids[rand() % 16]), nullptr});
+      continue;
+    }
+    Entity &e = entities[rand() % entities.size()];
+    requests.push_back(Request{StringRef(e.domain), StringRef(object_ids[&e - entities.data()]), &e.entity});
+  }
+
+  printf("%zu entities\n", entities.size());
+  bench("entity list search", requests,
+        [&](const StringRef &domain, const StringRef &id) { return find_linear(lists, domain, id); });
+  bench("hash + get_object_id", requests,
+        [&](const StringRef &domain, const StringRef &id) { return copying.find(domain, id); });
+  bench("RouteIndex", requests, [&](const StringRef &domain, const StringRef &id) { return index.find(domain, id); });
+  return 0;
+}